@@ -134,7 +134,7 @@ func _on_key_input(key: String):
 		"redo": redo()
 
 func save_undo_state():
-	undo_stack.push_back(Editor.get_tile_id_cache())
+	undo_stack.push_back(Editor.get_tile_data())
 	if undo_stack.size() > MAX_UNDOS:
 		undo_stack.pop_front()
 	redo_stack.clear()
@@ -142,17 +142,17 @@ func save_undo_state():
 func undo():
 	if undo_stack.is_empty(): return
 	
-	redo_stack.push_back(Editor.get_tile_id_cache())
+	redo_stack.push_back(Editor.get_tile_data())
 	var state = undo_stack.pop_back()
-	Editor.set_tile_id_cache(state)
+	Editor.set_tile_data(state)
 	Editor.update_visuals(Vector2i(0, 0))
 
 func redo():
 	if redo_stack.is_empty(): return
 	
-	undo_stack.push_back(Editor.get_tile_id_cache())
+	undo_stack.push_back(Editor.get_tile_data())
 	var state = redo_stack.pop_back()
-	Editor.set_tile_id_cache(state)
+	Editor.set_tile_data(state)
 	Editor.update_visuals(Vector2i(0, 0))
 
 func select_tile(id :String, is_primary :bool = true):
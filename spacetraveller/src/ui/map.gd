@@ -2,14 +2,21 @@ extends Control
 
 @onready var MapView :SubViewport = get_node("/root/Main/MapView")
 @onready var Camera :ViewCamera = get_node("/root/Main/MapView/Camera")
-@onready var Tilemap :TileMapLayer = get_node("/root/Main/MapView/TileMap")
+@onready var RegionMap :Sprite2D = get_node("/root/Main/MapView/RegionMap")
+@onready var World :WorldGeneration = get_node("/root/Main/WorldGen")
 @onready var playerChunk :TextureRect = get_node("/root/Main/MapView/PlayerChunk")
 @onready var container :MarginContainer = $MarginContainer
 
-const SOURCE :int = 2
 var REGION_SIZE = WorldGeneration.get_region_size()
 var TILE_SIZE = FastTileMap.get_tile_size()
 
+# Full chunk sprites instead of one averaged colour per chunk (12x the pixels per side)
+@export var chunkSprites :bool = false
+
+# One overview sprite per region, built only while the map is open
+var regionSprites :Dictionary = {}
+var pendingRegions :Dictionary = {}
+
 func _ready():
 	get_window().size_changed.connect(resize_viewport)
 	resized.connect(resize_viewport)
@@ -24,35 +31,42 @@ func _ready():
 	Camera.limits = Rect2(0, 0, REGION_SIZE * TILE_SIZE, REGION_SIZE * TILE_SIZE)
 	Camera._view_centered()
 
-func _on_world_generated(regionChunks: Dictionary) -> void:
-	if regionChunks.is_empty():
+func _on_world_generated(regionData: Dictionary) -> void:
+	if regionData.is_empty():
 		return
 	
-	# Determine bounds from any key in the dictionary
-	var firstKey = regionChunks.keys()[0]
-	var coords = WorldGeneration.unpack_coords(firstKey)
-	var coordX = coords.x
-	var coordY = coords.y
-	
-	var startX = floor(float(coordX) / REGION_SIZE) * REGION_SIZE
-	var startY = floor(float(coordY) / REGION_SIZE) * REGION_SIZE
-	
-	for y in range(startY, startY + REGION_SIZE):
-		for x in range(startX, startX + REGION_SIZE):
-			var key = WorldGeneration.pack_coords(x, y)
-			var chunkID = regionChunks.get(key, "")
-			
-			if chunkID == "":
-				continue
-				
-			var atlas :Vector2i = ChunkDb.get_atlas_coords(chunkID)
-			Tilemap.set_cell(Vector2i(x, y), SOURCE, atlas)
-	
-	MapView.size = container.get_size()
+	var regionPos :Vector2i = regionData["position"]
+	if regionSprites.has(regionPos):
+		return
+	pendingRegions[regionPos] = true
+	if visible:
+		_build_pending_regions()
+
+func _build_pending_regions() -> void:
+	for regionPos in pendingRegions.keys():
+		# Regions evicted since their signal come back through region_ready
+		if not World.is_region_resident(regionPos):
+			continue
+		
+		# Composite the chunks natively; averaged colours are scaled up to the chunk footprint
+		var image :Image = World.build_region_map_image(regionPos, chunkSprites, chunkSprites)
+		if image == null:
+			continue
+		
+		var sprite := Sprite2D.new()
+		sprite.centered = false
+		sprite.texture = ImageTexture.create_from_image(image)
+		sprite.position = Vector2(regionPos * REGION_SIZE * TILE_SIZE)
+		if not chunkSprites:
+			sprite.scale = Vector2(TILE_SIZE, TILE_SIZE)
+		RegionMap.add_child(sprite)
+		regionSprites[regionPos] = sprite
+	pendingRegions.clear()
 
 func _map_toggled() -> void:
 	visible = !visible
 	if visible:
+		_build_pending_regions()
 		Camera._view_centered()
 
 func _on_player_moved_chunk(chunkPos: Vector2) -> void:
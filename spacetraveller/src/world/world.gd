@@ -4,7 +4,7 @@ extends WorldGeneration
 @export var Player :Sprite2D
 @onready var BiomeNoise :FastNoiseLite = preload("res://noise/biome_noise.tres")
 
-signal generated(regionChunks)
+signal generated(regionData)
 
 var seed_ :int = randi()
 
@@ -14,12 +14,17 @@ func _ready() -> void:
 	world_seed = seed_
 	
 	InputManager.inventory_item_dropped.connect(_on_inventory_item_dropped)
+	region_ready.connect(_on_region_ready)
 
 func _on_inventory_item_dropped(ID: String, amount: int) -> void:
 	drop_item(Vector2i(Player.cellPos), ID, amount)
 	update_world_bubble(Player.cellPos)
 
 func generate_world(playerPos :Vector2i) -> void:
-	var regionChunks = init_region(Vector2i.ZERO)
 	init_world_bubble(playerPos)
-	generated.emit(regionChunks)
+	init_region_async(WorldGeneration.get_region_at(playerPos))
+
+func _on_region_ready(_regionPos :Vector2i, regionData :Dictionary) -> void:
+	# Redraw cells that were rendered before the region existed
+	update_world_bubble(Player.cellPos)
+	generated.emit(regionData)
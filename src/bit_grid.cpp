@@ -0,0 +1,62 @@
+#include "bit_grid.h"
+#include <algorithm>
+#include <cstring>
+
+namespace godot {
+
+BitGrid::Page* BitGrid::find_page(int px, int py) const {
+    uint64_t key = page_key(px, py);
+    if (last_page && last_page_key == key) {
+        return last_page;
+    }
+
+    auto it = pages.find(key);
+    if (it == pages.end()) {
+        return nullptr;
+    }
+
+    last_page_key = key;
+    last_page = it->second.get();
+    return last_page;
+}
+
+BitGrid::Page* BitGrid::get_or_create_page(int px, int py) {
+    Page* page = find_page(px, py);
+    if (page) return page;
+
+    std::unique_ptr<Page> new_page = std::make_unique<Page>();
+    std::fill(std::begin(new_page->rows), std::end(new_page->rows), 0);
+
+    uint64_t key = page_key(px, py);
+    page = new_page.get();
+    pages[key] = std::move(new_page);
+
+    last_page_key = key;
+    last_page = page;
+    return page;
+}
+
+void BitGrid::set_page(int px, int py, const uint64_t* rows) {
+    Page* page = get_or_create_page(px, py);
+    std::memcpy(page->rows, rows, sizeof(page->rows));
+}
+
+void BitGrid::erase_pages(int x0, int y0, int x1, int y1) {
+    for (auto it = pages.begin(); it != pages.end();) {
+        const int px = static_cast<int>(static_cast<int32_t>(it->first >> 32));
+        const int py = static_cast<int>(static_cast<int32_t>(it->first & 0xFFFFFFFF));
+        const bool inside = (px << PAGE_SHIFT) >= x0 && ((px + 1) << PAGE_SHIFT) <= x1 &&
+                            (py << PAGE_SHIFT) >= y0 && ((py + 1) << PAGE_SHIFT) <= y1;
+        it = inside ? pages.erase(it) : std::next(it);
+    }
+    last_page = nullptr;
+    last_page_key = 0;
+}
+
+void BitGrid::clear() {
+    pages.clear();
+    last_page = nullptr;
+    last_page_key = 0;
+}
+
+}
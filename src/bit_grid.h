@@ -0,0 +1,89 @@
+#ifndef SPACETRAVELLER_BIT_GRID_H
+#define SPACETRAVELLER_BIT_GRID_H
+
+#include <unordered_map>
+#include <memory>
+#include <cstdint>
+#include <cstddef>
+
+namespace godot {
+
+// Paged 1-bit-per-cell grid.
+// Each 64x64 page stores one uint64_t per row, so a row of 64 cells can be
+// tested with a single word. Unset pages read as 0.
+class BitGrid {
+public:
+    static constexpr int PAGE_SHIFT = 6;
+    static constexpr int PAGE_SIZE = 1 << PAGE_SHIFT;
+    static constexpr int PAGE_MASK = PAGE_SIZE - 1;
+
+    struct Page {
+        uint64_t rows[PAGE_SIZE];
+    };
+
+private:
+    std::unordered_map<uint64_t, std::unique_ptr<Page>> pages;
+
+    // Performance Cache: Last Page
+    mutable uint64_t last_page_key = 0;
+    mutable Page* last_page = nullptr;
+
+    static inline uint64_t page_key(int px, int py) {
+        return (static_cast<uint64_t>(static_cast<uint32_t>(px)) << 32) |
+               static_cast<uint64_t>(static_cast<uint32_t>(py));
+    }
+
+    Page* find_page(int px, int py) const;
+    Page* get_or_create_page(int px, int py);
+
+public:
+    BitGrid() = default;
+    BitGrid(const BitGrid&) = delete;
+    BitGrid& operator=(const BitGrid&) = delete;
+
+    inline bool get(int x, int y) const {
+        const Page* page = find_page(x >> PAGE_SHIFT, y >> PAGE_SHIFT);
+        if (!page) return false;
+        return (page->rows[y & PAGE_MASK] >> (x & PAGE_MASK)) & 1;
+    }
+
+    inline void set(int x, int y, bool p_value) {
+        if (!p_value) {
+            Page* page = find_page(x >> PAGE_SHIFT, y >> PAGE_SHIFT);
+            if (page) page->rows[y & PAGE_MASK] &= ~(uint64_t(1) << (x & PAGE_MASK));
+            return;
+        }
+        Page* page = get_or_create_page(x >> PAGE_SHIFT, y >> PAGE_SHIFT);
+        page->rows[y & PAGE_MASK] |= (uint64_t(1) << (x & PAGE_MASK));
+    }
+
+    // The 64-cell row word containing (x, y); bit i is cell ((x & ~63) + i, y)
+    inline uint64_t get_word(int x, int y) const {
+        const Page* page = find_page(x >> PAGE_SHIFT, y >> PAGE_SHIFT);
+        return page ? page->rows[y & PAGE_MASK] : 0;
+    }
+
+    // Overwrites a whole page with PAGE_SIZE row words
+    void set_page(int px, int py, const uint64_t* rows);
+
+    void clear();
+    // Drops every page lying entirely inside the cell rect [x0, x1) x [y0, y1);
+    // a page-aligned rect is cleared completely
+    void erase_pages(int x0, int y0, int x1, int y1);
+
+    size_t get_page_count() const { return pages.size(); }
+    size_t get_memory_usage() const { return pages.size() * (sizeof(Page) + sizeof(uint64_t) + sizeof(void*)); }
+
+    template <typename F>
+    void for_each_page(F&& f) const {
+        for (const auto& pair : pages) {
+            const int px = static_cast<int>(static_cast<int32_t>(pair.first >> 32));
+            const int py = static_cast<int>(static_cast<int32_t>(pair.first & 0xFFFFFFFF));
+            f(px, py, *pair.second);
+        }
+    }
+};
+
+}
+
+#endif // SPACETRAVELLER_BIT_GRID_H
@@ -27,11 +27,69 @@ CityPixel Canvas::getPixel(int x, int y) const {
     return {0, 0};
 }
 
+void Canvas::fillSpan(int y, int x0, int x1, uint16_t p_id, uint8_t p_meta, std::initializer_list<uint16_t> p_keep) {
+    if (y < 0 || y >= gridSize) return;
+    x0 = std::max(x0, 0);
+    x1 = std::min(x1, gridSize - 1);
+    if (x0 > x1) return;
+
+    CityPixel* row = &grid[y * gridSize];
+    const CityPixel pixel{p_id, p_meta};
+    if (p_keep.size() == 0) {
+        std::fill(row + x0, row + x1 + 1, pixel);
+        return;
+    }
+    std::replace_if(row + x0, row + x1 + 1, [&](const CityPixel& current) {
+        return std::find(p_keep.begin(), p_keep.end(), current.id) == p_keep.end();
+    }, pixel);
+}
+
 void Canvas::fillRect(int x, int y, int w, int h, uint16_t p_id, uint8_t p_meta) {
     for (int iy = y; iy < y + h; ++iy) {
-        for (int ix = x; ix < x + w; ++ix) {
-            setPixel(ix, iy, p_id, p_meta);
+        fillSpan(iy, x, x + w - 1, p_id, p_meta);
+    }
+}
+
+// One square root per row gives the span's half width
+void Canvas::fillCircle(double xm, double ym, double r, uint16_t p_id, uint8_t p_meta, std::initializer_list<uint16_t> p_keep) {
+    if (r < 0) return;
+    const int y0 = std::max(0, static_cast<int>(std::ceil(ym - r)));
+    const int y1 = std::min(gridSize - 1, static_cast<int>(std::floor(ym + r)));
+    for (int y = y0; y <= y1; ++y) {
+        const double dy = y - ym;
+        const double half = std::sqrt(std::max(0.0, r * r - dy * dy));
+        fillSpan(y, static_cast<int>(std::ceil(xm - half)), static_cast<int>(std::floor(xm + half)), p_id, p_meta, p_keep);
+    }
+}
+
+// Each row is clipped against the rectangle's two slabs (|local x| <= w/2 and
+// |local y| <= h/2); their overlap is the row's span
+void Canvas::fillRotatedRect(double cx, double cy, double w, double h, double angle, uint16_t p_id, uint8_t p_meta, std::initializer_list<uint16_t> p_keep) {
+    const double cosA = std::cos(-angle), sinA = std::sin(-angle);
+    const double halfW = w / 2.0, halfH = h / 2.0;
+    const double diagonal = std::hypot(halfW, halfH);
+
+    // Narrow [lo, hi] to the dx with |dx * k + offset| <= half
+    auto clip = [](double k, double offset, double half, double& lo, double& hi) {
+        if (std::abs(k) < 1e-12) {
+            if (std::abs(offset) > half) hi = lo - 1.0;
+            return;
         }
+        double a = (-half - offset) / k, b = (half - offset) / k;
+        if (a > b) std::swap(a, b);
+        lo = std::max(lo, a);
+        hi = std::min(hi, b);
+    };
+
+    const int y0 = std::max(0, static_cast<int>(std::floor(cy - diagonal)));
+    const int y1 = std::min(gridSize - 1, static_cast<int>(std::ceil(cy + diagonal)));
+    for (int y = y0; y <= y1; ++y) {
+        const double dy = y - cy;
+        double lo = -diagonal, hi = diagonal;
+        clip(cosA, -dy * sinA, halfW, lo, hi); // local x = dx * cosA - dy * sinA
+        clip(sinA, dy * cosA, halfH, lo, hi);  // local y = dx * sinA + dy * cosA
+        if (lo > hi) continue;
+        fillSpan(y, static_cast<int>(std::ceil(cx + lo)), static_cast<int>(std::floor(cx + hi)), p_id, p_meta, p_keep);
     }
 }
 
@@ -83,4 +141,17 @@ void Canvas::drawCircle(double xm, double ym, double r, uint16_t p_id, uint8_t p
     }
 }
 
+void Canvas::composite(const Canvas& p_source, int x, int y, uint16_t p_transparent_id) {
+    const int x0 = std::max(0, x), x1 = std::min(gridSize, x + p_source.gridSize);
+    const int y0 = std::max(0, y), y1 = std::min(gridSize, y + p_source.gridSize);
+    for (int iy = y0; iy < y1; ++iy) {
+        const CityPixel* src = p_source.getRow(iy - y);
+        CityPixel* dst = &grid[iy * gridSize];
+        for (int ix = x0; ix < x1; ++ix) {
+            const CityPixel& pixel = src[ix - x];
+            if (pixel.id != p_transparent_id) dst[ix] = pixel;
+        }
+    }
+}
+
 }
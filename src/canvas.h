@@ -5,6 +5,7 @@
 #include <vector>
 #include <string>
 #include <cstdint>
+#include <initializer_list>
 
 namespace godot {
 
@@ -39,10 +40,20 @@ public:
     void clear(uint16_t p_id = 0, uint8_t p_meta = 0);
     void setPixel(int x, int y, uint16_t p_id, uint8_t p_meta = 0);
     CityPixel getPixel(int x, int y) const;
+    const CityPixel* getRow(int y) const { return &grid[y * gridSize]; }
     
+    // Span fills write whole clipped row segments. Pixels whose id is in
+    // p_keep are left untouched.
+    void fillSpan(int y, int x0, int x1, uint16_t p_id, uint8_t p_meta = 0, std::initializer_list<uint16_t> p_keep = {}); // Inclusive [x0, x1]
     void fillRect(int x, int y, int w, int h, uint16_t p_id, uint8_t p_meta = 0);
+    // Every pixel whose centre lies within r of (xm, ym)
+    void fillCircle(double xm, double ym, double r, uint16_t p_id, uint8_t p_meta = 0, std::initializer_list<uint16_t> p_keep = {});
+    // A w x h rectangle centred on (cx, cy), rotated by angle radians
+    void fillRotatedRect(double cx, double cy, double w, double h, double angle, uint16_t p_id, uint8_t p_meta = 0, std::initializer_list<uint16_t> p_keep = {});
     void drawLine(int x0, int y0, int x1, int y1, uint16_t p_id, uint8_t p_meta = 0);
     void drawCircle(double xm, double ym, double r, uint16_t p_id, uint8_t p_meta = 0);
+    // Copy every pixel of p_source that is not p_transparent_id, with its origin at (x, y)
+    void composite(const Canvas& p_source, int x, int y, uint16_t p_transparent_id);
     
     int get_grid_size() const { return gridSize; }
 };
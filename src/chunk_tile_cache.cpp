@@ -0,0 +1,56 @@
+#include "chunk_tile_cache.h"
+
+namespace godot {
+
+const uint16_t* ChunkTileCache::find_slow(uint64_t key) {
+    auto it = entries.find(key);
+    if (it == entries.end()) {
+        return nullptr;
+    }
+
+    lru.splice(lru.begin(), lru, it->second);
+    last_key = key;
+    last_entry = &lru.front();
+    return last_entry->tiles.data();
+}
+
+uint16_t* ChunkTileCache::insert(int cx, int cy) {
+    const uint64_t key = chunk_key(cx, cy);
+    auto it = entries.find(key);
+    if (it != entries.end()) {
+        lru.splice(lru.begin(), lru, it->second);
+    } else {
+        const size_t entry_size = get_entry_size();
+        evict_to(budget > entry_size ? budget - entry_size : 0);
+        lru.push_front(Entry{key, std::vector<uint16_t>(chunk_cells)});
+        entries[key] = lru.begin();
+    }
+
+    last_key = key;
+    last_entry = &lru.front();
+    return last_entry->tiles.data();
+}
+
+void ChunkTileCache::evict_to(size_t p_bytes) {
+    while (!lru.empty() && get_memory_usage() > p_bytes) {
+        if (last_entry == &lru.back()) {
+            last_entry = nullptr;
+        }
+        entries.erase(lru.back().key);
+        lru.pop_back();
+    }
+}
+
+void ChunkTileCache::clear() {
+    entries.clear();
+    lru.clear();
+    last_entry = nullptr;
+    last_key = 0;
+}
+
+void ChunkTileCache::set_budget(size_t p_bytes) {
+    budget = p_bytes;
+    evict_to(budget);
+}
+
+}
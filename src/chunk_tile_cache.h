@@ -0,0 +1,71 @@
+#ifndef SPACETRAVELLER_CHUNK_TILE_CACHE_H
+#define SPACETRAVELLER_CHUNK_TILE_CACHE_H
+
+#include <unordered_map>
+#include <list>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+namespace godot {
+
+// Cache of generated chunk tiles under a memory budget.
+// Each chunk is a row-major array of tile ids; when inserting would exceed
+// the budget, the least recently used chunks are evicted. Evicted chunks are
+// expected to be regenerated deterministically by the owner on a miss.
+class ChunkTileCache {
+private:
+    struct Entry {
+        uint64_t key;
+        std::vector<uint16_t> tiles;
+    };
+
+    int chunk_cells;
+    size_t budget;
+    std::list<Entry> lru; // Front is the most recently used
+    std::unordered_map<uint64_t, std::list<Entry>::iterator> entries;
+
+    // Performance Cache: Last Chunk (always the front of lru)
+    uint64_t last_key = 0;
+    Entry* last_entry = nullptr;
+
+    static inline uint64_t chunk_key(int cx, int cy) {
+        return (static_cast<uint64_t>(static_cast<uint32_t>(cx)) << 32) |
+               static_cast<uint64_t>(static_cast<uint32_t>(cy));
+    }
+
+    size_t get_entry_size() const {
+        return sizeof(Entry) + chunk_cells * sizeof(uint16_t) + sizeof(uint64_t) + 4 * sizeof(void*);
+    }
+    const uint16_t* find_slow(uint64_t key);
+    void evict_to(size_t p_bytes);
+
+public:
+    explicit ChunkTileCache(int p_chunk_cells, size_t p_budget = 8 * 1024 * 1024)
+        : chunk_cells(p_chunk_cells), budget(p_budget) {}
+    ChunkTileCache(const ChunkTileCache&) = delete;
+    ChunkTileCache& operator=(const ChunkTileCache&) = delete;
+
+    // Tiles of a cached chunk, marked most recently used. nullptr on a miss.
+    inline const uint16_t* find(int cx, int cy) {
+        const uint64_t key = chunk_key(cx, cy);
+        if (last_entry && last_key == key) {
+            return last_entry->tiles.data();
+        }
+        return find_slow(key);
+    }
+
+    // Storage for a chunk about to be generated, evicting over budget
+    uint16_t* insert(int cx, int cy);
+
+    void clear();
+
+    void set_budget(size_t p_bytes);
+    size_t get_budget() const { return budget; }
+    size_t get_chunk_count() const { return entries.size(); }
+    size_t get_memory_usage() const { return entries.size() * get_entry_size(); }
+};
+
+}
+
+#endif // SPACETRAVELLER_CHUNK_TILE_CACHE_H
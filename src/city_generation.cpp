@@ -1,16 +1,45 @@
 #include "city_generation.h"
 #include "world_generation.h"
 #include "data/id_registry.h"
+#include "coord_hash.h"
 #include <iostream>
 #include <cmath>
 #include <algorithm>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
 #include <godot_cpp/classes/json.hpp>
 #include <godot_cpp/variant/utility_functions.hpp>
+#include <godot_cpp/variant/callable_method_pointer.hpp>
+#include <godot_cpp/classes/worker_thread_pool.hpp>
 
 namespace godot {
 
-CityGeneration::CityGeneration(Canvas& p_canvas, uint32_t seed, IdRegistry* p_registry) 
-    : canvas(p_canvas), rng(seed), registry(p_registry) {
+namespace {
+    // CityRandom stream kinds. A stream is its kind in the top 8 bits and an
+    // id below them (see make_stream), so no two kinds can share a stream
+    // whatever their ids are.
+    constexpr uint64_t STREAM_SPOKE_JITTER = 1;
+    constexpr uint64_t STREAM_SPAWN = 2;
+    constexpr uint64_t STREAM_RING_JITTER = 3;
+    constexpr uint64_t STREAM_SECTOR = 4;
+
+    constexpr int STREAM_KIND_SHIFT = 56;
+    constexpr uint64_t STREAM_ID_MASK = (uint64_t(1) << STREAM_KIND_SHIFT) - 1;
+
+    uint64_t make_stream(uint64_t kind, uint64_t id = 0) {
+        return (kind << STREAM_KIND_SHIFT) | (id & STREAM_ID_MASK);
+    }
+
+    // Sector ids: inner city sectors by (ring, gate), outer ones by (ring, edge).
+    // 1 + 24 + 24 bits, well below STREAM_KIND_SHIFT.
+    uint64_t sector_id(bool outer, int ring, int index) {
+        return (uint64_t(outer) << 48) | ((uint64_t(uint32_t(ring)) & 0xFFFFFF) << 24) | (uint32_t(index) & 0xFFFFFF);
+    }
+}
+
+CityGeneration::CityGeneration(Canvas& p_canvas, uint32_t seed, IdRegistry* p_registry, bool p_parallel_sectors) 
+    : canvas(p_canvas), rng(seed), parallel_sectors(p_parallel_sectors), registry(p_registry) {
     
     id_road = registry->register_string("road");
     id_alley = registry->register_string("alley");
@@ -27,39 +56,81 @@ CityGeneration::CityGeneration(Canvas& p_canvas, uint32_t seed, IdRegistry* p_re
     randomize();
 }
 
-double CityGeneration::randomDouble() {
-    std::uniform_real_distribution<double> dist(0.0, 1.0);
-    return dist(rng);
-}
-
 void CityGeneration::randomize() {
     spokeJitters.clear();
-    for (int i = 0; i < 32; ++i) spokeJitters.push_back((randomDouble() - 0.5) * 2.0);
+    for (int i = 0; i < 32; ++i) spokeJitters.push_back((rng.unit(make_stream(STREAM_SPOKE_JITTER), i) - 0.5) * 2.0);
 
     spawnRands.clear();
-    for (int i = 0; i < 12; ++i) spawnRands.push_back(randomDouble());
+    for (int i = 0; i < 12; ++i) spawnRands.push_back(rng.unit(make_stream(STREAM_SPAWN), i));
 }
 
-bool CityGeneration::isInSector(int px, int py, double cx, double cy, double a1, double a2, double r1, double r2) {
-    double dx = px - cx, dy = py - cy;
-    double d = std::hypot(dx, dy);
-    if (d < r1 - 0.5 || d > r2 + 0.5) return false;
-    double angle = std::atan2(dy, dx);
-    if (angle < 0) angle += Math_PI * 2.0;
+namespace {
+    // Distance and angle of every integer offset within POLAR_FIELD_RADIUS of a
+    // city centre. Built once and shared by every city and worker thread.
+    constexpr int POLAR_FIELD_RADIUS = 128;
+    constexpr int POLAR_FIELD_SIZE = POLAR_FIELD_RADIUS * 2 + 1;
+
+    struct PolarSample {
+        double dist;
+        double angle; // [0, 2pi)
+    };
+
+    PolarSample compute_polar(double dx, double dy) {
+        double angle = std::atan2(dy, dx);
+        if (angle < 0) angle += Math_PI * 2.0;
+        return { std::hypot(dx, dy), angle };
+    }
+
+    const std::vector<PolarSample>& get_polar_field() {
+        static const std::vector<PolarSample> field = [] {
+            std::vector<PolarSample> samples(POLAR_FIELD_SIZE * POLAR_FIELD_SIZE);
+            for (int dy = -POLAR_FIELD_RADIUS; dy <= POLAR_FIELD_RADIUS; ++dy) {
+                for (int dx = -POLAR_FIELD_RADIUS; dx <= POLAR_FIELD_RADIUS; ++dx) {
+                    samples[(dy + POLAR_FIELD_RADIUS) * POLAR_FIELD_SIZE + dx + POLAR_FIELD_RADIUS] = compute_polar(dx, dy);
+                }
+            }
+            return samples;
+        }();
+        return field;
+    }
+}
 
+CityGeneration::SectorBounds CityGeneration::makeSector(double cx, double cy, double a1, double a2, double r1, double r2) {
     auto normalize = [](double a) {
         double res = fmod(a, Math_PI * 2.0);
         if (res < 0) res += Math_PI * 2.0;
         return res;
     };
 
-    double s = normalize(a1);
-    double e = normalize(a2);
+    SectorBounds sector;
+    sector.cx = cx;
+    sector.cy = cy;
+    sector.r_min = r1 - 0.5;
+    sector.r_max = r2 + 0.5;
+    sector.start = normalize(a1);
+    sector.end = normalize(a2);
+    sector.icx = static_cast<int>(cx);
+    sector.icy = static_cast<int>(cy);
+    sector.integral_centre = (sector.icx == cx && sector.icy == cy);
+    return sector;
+}
 
-    return s > e ? (angle >= s || angle <= e) : (angle >= s && angle <= e);
+bool CityGeneration::isInSector(int px, int py, const SectorBounds& sector) {
+    // City centres are whole pixels, so the offset indexes the shared polar field
+    PolarSample polar;
+    const int dx = px - sector.icx, dy = py - sector.icy;
+    if (sector.integral_centre && std::abs(dx) <= POLAR_FIELD_RADIUS && std::abs(dy) <= POLAR_FIELD_RADIUS) {
+        polar = get_polar_field()[(dy + POLAR_FIELD_RADIUS) * POLAR_FIELD_SIZE + dx + POLAR_FIELD_RADIUS];
+    } else {
+        polar = compute_polar(px - sector.cx, py - sector.cy);
+    }
+
+    if (polar.dist < sector.r_min || polar.dist > sector.r_max) return false;
+    return sector.start > sector.end ? (polar.angle >= sector.start || polar.angle <= sector.end)
+                                     : (polar.angle >= sector.start && polar.angle <= sector.end);
 }
 
-bool CityGeneration::canPlacePixel(int x, int y, uint16_t val_id) {
+bool CityGeneration::canPlacePixel(int x, int y, uint16_t val_id) const {
     CityPixel current = canvas.getPixel(x, y);
     if (val_id == id_road) {
         return (current.id != id_water && current.id != id_palace && current.id != id_gate);
@@ -71,28 +142,27 @@ bool CityGeneration::canPlacePixel(int x, int y, uint16_t val_id) {
     }
 }
 
-void CityGeneration::drawRestrictedLine(int x0, int y0, int x1, int y1, uint16_t val_id, double cx, double cy, double a1, double a2, double r1, double r2, uint8_t p_meta) {
+// Trace a line clipped to the sector, recording the canvas indices it may claim
+void CityGeneration::drawRestrictedLine(int x0, int y0, int x1, int y1, uint16_t val_id, const SectorBounds& sector, std::vector<int>& r_pixels) const {
+    const int gridSize = canvas.get_grid_size();
+    auto claim = [&](int px, int py) {
+        if (px < 0 || px >= gridSize || py < 0 || py >= gridSize) return;
+        if (isInSector(px, py, sector) && canPlacePixel(px, py, val_id)) {
+            r_pixels.push_back(py * gridSize + px);
+        }
+    };
+
     int dx = std::abs(x1 - x0), sx = x0 < x1 ? 1 : -1;
     int dy = -std::abs(y1 - y0), sy = y0 < y1 ? 1 : -1;
     int err = dx + dy, e2;
     while (true) {
-        if (isInSector(x0, y0, cx, cy, a1, a2, r1, r2)) {
-            if (canPlacePixel(x0, y0, val_id)) {
-                canvas.setPixel(x0, y0, val_id, p_meta);
-            }
-        }
+        claim(x0, y0);
         if (x0 == x1 && y0 == y1) break;
         e2 = 2 * err;
 
         // Cardinal connectivity fix
         if (e2 >= dy && e2 <= dx) {
-            int cx0 = x0, cy0 = y0;
-            if (dx > -dy) cx0 += sx; else cy0 += sy;
-            if (isInSector(cx0, cy0, cx, cy, a1, a2, r1, r2)) {
-                if (canPlacePixel(cx0, cy0, val_id)) {
-                    canvas.setPixel(cx0, cy0, val_id, p_meta);
-                }
-            }
+            if (dx > -dy) claim(x0 + sx, y0); else claim(x0, y0 + sy);
         }
 
         if (e2 >= dy) { err += dy; x0 += sx; }
@@ -100,23 +170,27 @@ void CityGeneration::drawRestrictedLine(int x0, int y0, int x1, int y1, uint16_t
     }
 }
 
-void CityGeneration::splitSector(int x, int y, int w, int h, int depth, double cx, double cy, double a1, double a2, double r1, double r2) {
+// Nodes are numbered like a binary heap (children 2n and 2n + 1), so each
+// split draws from the sector stream at a counter fixed by its depth and path
+void CityGeneration::splitSector(SectorJob& job, const SectorBounds& sector, int x, int y, int w, int h, int depth, uint64_t node) const {
     if (depth <= 0 || w < 5 || h < 5) return;
+    const double roll = rng.unit(make_stream(STREAM_SECTOR, job.id), node);
     if (w > h) {
-        int sx = x + static_cast<int>(w * (0.35 + randomDouble() * 0.3));
-        drawRestrictedLine(sx, y, sx, y + h, id_alley, cx, cy, a1, a2, r1, r2);
-        splitSector(x, y, sx - x, h, depth - 1, cx, cy, a1, a2, r1, r2);
-        splitSector(sx + 1, y, x + w - sx - 1, h, depth - 1, cx, cy, a1, a2, r1, r2);
+        int sx = x + static_cast<int>(w * (0.35 + roll * 0.3));
+        drawRestrictedLine(sx, y, sx, y + h, id_alley, sector, job.pixels);
+        splitSector(job, sector, x, y, sx - x, h, depth - 1, node * 2);
+        splitSector(job, sector, sx + 1, y, x + w - sx - 1, h, depth - 1, node * 2 + 1);
     } else {
-        int sy = y + static_cast<int>(h * (0.35 + randomDouble() * 0.3));
-        drawRestrictedLine(x, sy, x + w, sy, id_alley, cx, cy, a1, a2, r1, r2);
-        splitSector(x, y, w, sy - y, depth - 1, cx, cy, a1, a2, r1, r2);
-        splitSector(x, sy + 1, w, y + h - sy - 1, depth - 1, cx, cy, a1, a2, r1, r2);
+        int sy = y + static_cast<int>(h * (0.35 + roll * 0.3));
+        drawRestrictedLine(x, sy, x + w, sy, id_alley, sector, job.pixels);
+        splitSector(job, sector, x, y, w, sy - y, depth - 1, node * 2);
+        splitSector(job, sector, x, sy + 1, w, y + h - sy - 1, depth - 1, node * 2 + 1);
     }
 }
 
-void CityGeneration::subdivideSector(double cx, double cy, double a1, double a2, double r1, double r2, int depth) {
-    double start = a1, end = a2;
+void CityGeneration::subdivideSector(SectorJob& job) const {
+    const double cx = job.cx, cy = job.cy, r1 = job.r1, r2 = job.r2;
+    double start = job.a1, end = job.a2;
     if (std::abs(end - start) > Math_PI) {
         if (start < end) start += Math_PI * 2.0; else end += Math_PI * 2.0;
     }
@@ -131,31 +205,45 @@ void CityGeneration::subdivideSector(double cx, double cy, double a1, double a2,
         minX = std::min(minX, corners[i][0]); minY = std::min(minY, corners[i][1]);
         maxX = std::max(maxX, corners[i][0]); maxY = std::max(maxY, corners[i][1]);
     }
-    splitSector(std::floor(minX), std::floor(minY), std::ceil(maxX - minX), std::ceil(maxY - minY), depth, cx, cy, a1, a2, r1, r2);
+    const SectorBounds sector = makeSector(cx, cy, job.a1, job.a2, r1, r2);
+    splitSector(job, sector, std::floor(minX), std::floor(minY), std::ceil(maxX - minX), std::ceil(maxY - minY), job.depth, 1);
 }
 
-void CityGeneration::drawEmptyMarketSquare(double cx, double cy, double angle, int w, int h) {
-    double cosA = std::cos(-angle), sinA = std::sin(-angle);
-    double halfW = w / 2.0, halfH = h / 2.0;
-    double diagonal = std::hypot(halfW, halfH);
-    int startY = std::floor(cy - diagonal), endY = std::ceil(cy + diagonal);
-    int startX = std::floor(cx - diagonal), endX = std::ceil(cx + diagonal);
+void CityGeneration::_sector_task(uint32_t p_index, uint64_t p_gen) {
+    const CityGeneration* gen = reinterpret_cast<const CityGeneration*>(p_gen);
+    gen->subdivideSector((*gen->pending_sectors)[p_index]);
+}
 
-    int gridSize = canvas.get_grid_size();
-    for (int y = startY; y <= endY; ++y) {
-        for (int x = startX; x <= endX; ++x) {
-            if (y < 0 || y >= gridSize || x < 0 || x >= gridSize) continue;
-            double dx = x - cx, dy = y - cy;
-            double localX = dx * cosA - dy * sinA;
-            double localY = dx * sinA + dy * cosA;
-            if (std::abs(localX) <= halfW && std::abs(localY) <= halfH) {
-                CityPixel current = canvas.getPixel(x, y);
-                if (current.id != id_water && current.id != id_palace) {
-                    canvas.setPixel(x, y, id_plains);
-                }
-            }
+// Alleys only ever claim void pixels, so sectors can read the canvas while
+// others are still running. Claims are applied afterwards, and because an
+// alley pixel is the same whichever sector claimed it, the result does not
+// depend on the order or the thread count.
+void CityGeneration::runSectors(std::vector<SectorJob>& jobs) {
+    WorkerThreadPool* pool = WorkerThreadPool::get_singleton();
+    if (parallel_sectors && pool && jobs.size() > 1) {
+        pending_sectors = &jobs;
+        const int64_t group = pool->add_group_task(
+            callable_mp_static(&CityGeneration::_sector_task).bind(reinterpret_cast<uint64_t>(this)),
+            static_cast<int>(jobs.size()), -1, true, "City sector generation"
+        );
+        pool->wait_for_group_task_completion(group);
+        pending_sectors = nullptr;
+    } else {
+        for (SectorJob& job : jobs) {
+            subdivideSector(job);
+        }
+    }
+
+    const int gridSize = canvas.get_grid_size();
+    for (const SectorJob& job : jobs) {
+        for (int index : job.pixels) {
+            canvas.setPixel(index % gridSize, index / gridSize, id_alley);
         }
     }
+}
+
+void CityGeneration::drawEmptyMarketSquare(double cx, double cy, double angle, int w, int h) {
+    canvas.fillRotatedRect(cx, cy, w, h, angle, id_plains, 0, { id_water, id_palace });
     double rCos = std::cos(angle), rSin = std::sin(angle);
     Point corners[4] = {
         {static_cast<int>(-w/2), static_cast<int>(-h/2)}, 
@@ -174,21 +262,11 @@ void CityGeneration::drawEmptyMarketSquare(double cx, double cy, double angle, i
 }
 
 void CityGeneration::drawEmptyGrandPlaza(double cx, double cy, double r) {
-    int gridSize = canvas.get_grid_size();
-    for (int y = std::floor(cy - r - 1); y <= std::ceil(cy + r + 1); ++y) {
-        for (int x = std::floor(cx - r - 1); x <= std::ceil(cx + r + 1); ++x) {
-            if (y < 0 || y >= gridSize || x < 0 || x >= gridSize) continue;
-            double dist = std::hypot(x - cx, y - cy);
-            CityPixel current = canvas.getPixel(x, y);
-            if (dist <= r + 0.5 && current.id != id_water && current.id != id_palace) {
-                canvas.setPixel(x, y, id_plaza);
-            }
-        }
-    }
+    canvas.fillCircle(cx, cy, r + 0.5, id_plaza, 0, { id_water, id_palace });
     canvas.drawCircle(cx, cy, r, id_road);
 }
 
-void CityGeneration::generateOuterDistricts(double cx, double cy, const std::vector<CityNode>& startNodes, int reach, int density) {
+void CityGeneration::generateOuterDistricts(double cx, double cy, const std::vector<CityNode>& startNodes, int reach, int density, std::vector<SectorJob>& r_sectors) {
     int numRings = std::max(1, static_cast<int>(std::floor(reach / 18.0)));
     double stepLen = static_cast<double>(reach) / numRings;
     std::vector<CityNode> previousLayer = startNodes;
@@ -211,35 +289,96 @@ void CityGeneration::generateOuterDistricts(double cx, double cy, const std::vec
             
             int mx = (p1.x + p2.x) / 2;
             int my = (p1.y + p2.y) / 2;
-            std::uniform_int_distribution<int> dist(-1, 1);
-            mx += dist(rng);
-            my += dist(rng);
+            const uint64_t edge = sector_id(true, r, static_cast<int>(i));
+            mx += rng.range(make_stream(STREAM_RING_JITTER, edge), 0, -1, 1);
+            my += rng.range(make_stream(STREAM_RING_JITTER, edge), 1, -1, 1);
             canvas.drawLine(p1.x, p1.y, mx, my, id_road);
             canvas.drawLine(mx, my, p2.x, p2.y, id_road);
 
             double rIn = std::hypot(previousLayer[i].x - cx, previousLayer[i].y - cy);
-            subdivideSector(cx, cy, p1.angle, p2.angle, rIn, currentRadius, density);
+            r_sectors.push_back({ cx, cy, p1.angle, p2.angle, rIn, currentRadius, density, edge, {} });
         }
         previousLayer = currentLayer;
     }
 }
 
-bool CityGeneration::isNearAnyRoad(int x, int y, int range) {
-    int gridSize = canvas.get_grid_size();
-    int dirs[4][2] = {{0, -1}, {0, 1}, {-1, 0}, {1, 0}};
-    
-    for (int i = 1; i <= range; ++i) {
-        for (auto& d : dirs) {
-            int nx = x + d[0] * i;
-            int ny = y + d[1] * i;
-            
-            if (ny >= 0 && ny < gridSize && nx >= 0 && nx < gridSize) {
-                CityPixel p = canvas.getPixel(nx, ny);
-                if (p.id == id_road || p.id == id_alley || p.id == id_plaza || p.id == id_wall || p.id == id_gate) return true;
+namespace {
+    inline int lowest_bit(uint64_t bits) {
+#if defined(_MSC_VER)
+        unsigned long index;
+        _BitScanForward64(&index, bits);
+        return static_cast<int>(index);
+#else
+        return __builtin_ctzll(bits);
+#endif
+    }
+}
+
+// Final building pass: void cells next to a street become buildings facing it.
+// Street adjacency comes from per-row bitmasks shifted and ORed together, so
+// the sweep only visits candidate cells instead of probing every neighbour.
+void CityGeneration::placeBuildings(double centerX, double centerY) {
+    const int gridSize = canvas.get_grid_size();
+    const int words = (gridSize + 63) / 64;
+
+    // One zero row of padding above and below keeps the vertical lookups branch free
+    std::vector<uint64_t> streetMask((gridSize + 2) * words, 0); // Any tile a building can stand next to
+    std::vector<uint64_t> facingMask((gridSize + 2) * words, 0); // Tiles a building turns to face
+    std::vector<uint64_t> voidMask(gridSize * words, 0);
+    for (int y = 0; y < gridSize; ++y) {
+        const CityPixel* row = canvas.getRow(y);
+        uint64_t* street = &streetMask[(y + 1) * words];
+        uint64_t* facing = &facingMask[(y + 1) * words];
+        uint64_t* empty = &voidMask[y * words];
+        for (int x = 0; x < gridSize; ++x) {
+            const uint16_t id = row[x].id;
+            const uint64_t bit = uint64_t(1) << (x & 63);
+            const bool faces = id == id_road || id == id_alley || id == id_wall || id == id_gate;
+            if (faces || id == id_plaza) street[x >> 6] |= bit;
+            if (faces) facing[x >> 6] |= bit;
+            if (id == id_void) empty[x >> 6] |= bit;
+        }
+    }
+
+    // Bit x of the result holds bit x - 1 (west neighbour) or x + 1 (east neighbour)
+    auto from_west = [](const uint64_t* row, int i) {
+        return (row[i] << 1) | (i > 0 ? row[i - 1] >> 63 : 0);
+    };
+    auto from_east = [words](const uint64_t* row, int i) {
+        return (row[i] >> 1) | (i + 1 < words ? row[i + 1] << 63 : 0);
+    };
+
+    const double maxDist = gridSize * 0.49;
+    for (int y = 0; y < gridSize; ++y) {
+        const uint64_t* street = &streetMask[(y + 1) * words];
+        const uint64_t* facing = &facingMask[(y + 1) * words];
+        for (int i = 0; i < words; ++i) {
+            const uint64_t near = from_west(street, i) | from_east(street, i) | street[i - words] | street[i + words];
+            uint64_t candidates = voidMask[y * words + i] & near;
+            if (!candidates) continue;
+
+            const uint64_t south = facing[i + words];
+            const uint64_t north = facing[i - words];
+            const uint64_t west = from_west(facing, i);
+            const uint64_t east = from_east(facing, i);
+            while (candidates) {
+                const int bit = lowest_bit(candidates);
+                candidates &= candidates - 1;
+
+                const int x = i * 64 + bit;
+                const double dist = std::hypot(x - centerX, y - centerY);
+                if (dist <= 2.0 || dist >= maxDist) continue;
+
+                uint8_t rotation = WorldGeneration::ROT_SOUTH;
+                if ((south >> bit) & 1) rotation = WorldGeneration::ROT_SOUTH;
+                else if ((north >> bit) & 1) rotation = WorldGeneration::ROT_NORTH;
+                else if ((west >> bit) & 1) rotation = WorldGeneration::ROT_WEST;
+                else if ((east >> bit) & 1) rotation = WorldGeneration::ROT_EAST;
+
+                canvas.setPixel(x, y, id_building, rotation);
             }
         }
     }
-    return false;
 }
 
 void CityGeneration::generateCity(
@@ -258,6 +397,7 @@ void CityGeneration::generateCity(
     int gateCount = showInner ? spokes : 6;
     double gateRadius = showInner ? static_cast<double>(radius) : 2.5;
     std::vector<CityNode> gateCoords;
+    std::vector<SectorJob> sectors;
 
     for (int i = 0; i < gateCount; ++i) {
         double jitter = useJitter ? (spokeJitters[i % spokeJitters.size()]) * (Math_PI / (gateCount * 1.5)) : 0;
@@ -288,7 +428,7 @@ void CityGeneration::generateCity(
             for (int r = 0; r < rings; ++r) {
                 double r1 = (r == 0 ? 8.0 : computedRingRadii[r - 1]);
                 double r2 = computedRingRadii[r];
-                subdivideSector(centerX, centerY, a1, a2, r1, r2, innerComp);
+                sectors.push_back({ centerX, centerY, a1, a2, r1, r2, innerComp, sector_id(false, r, i), {} });
             }
         }
     } else {
@@ -297,7 +437,10 @@ void CityGeneration::generateCity(
         }
     }
 
-    generateOuterDistricts(centerX, centerY, gateCoords, outerReach, outerComp);
+    generateOuterDistricts(centerX, centerY, gateCoords, outerReach, outerComp, sectors);
+
+    // Alleys go in once every road, wall and gate is down
+    runSectors(sectors);
 
     // Central Palace
     if (!showInner) {
@@ -326,32 +469,7 @@ void CityGeneration::generateCity(
     }
 
     // Final Building Pass
-    for (int y = 0; y < gridSize; ++y) {
-        for (int x = 0; x < gridSize; ++x) {
-            CityPixel current = canvas.getPixel(x, y);
-            if (current.id == id_void) { // Only place on void
-                double dist = std::hypot(x - centerX, y - centerY);
-                if (dist > 2.0 && dist < gridSize * 0.49) {
-                    if (isNearAnyRoad(x, y, 1)) {
-                        // Calculate rotation based on adjacent roads/alleys
-                        uint8_t rotation = WorldGeneration::ROT_SOUTH;
-                        auto is_road = [&](int nx, int ny) {
-                            if (nx < 0 || nx >= gridSize || ny < 0 || ny >= gridSize) return false;
-                            CityPixel p = canvas.getPixel(nx, ny);
-                            return p.id == id_road || p.id == id_alley || p.id == id_wall || p.id == id_gate;
-                        };
-
-                        if (is_road(x, y + 1)) rotation = WorldGeneration::ROT_SOUTH;
-                        else if (is_road(x, y - 1)) rotation = WorldGeneration::ROT_NORTH;
-                        else if (is_road(x - 1, y)) rotation = WorldGeneration::ROT_WEST;
-                        else if (is_road(x + 1, y)) rotation = WorldGeneration::ROT_EAST;
-
-                        canvas.setPixel(x, y, id_building, rotation);
-                    }
-                }
-            }
-        }
-    }
+    placeBuildings(centerX, centerY);
 }
 
 namespace {
@@ -373,58 +491,156 @@ namespace {
     constexpr bool USE_RIVER = false;
     constexpr bool USE_JITTER = true;
     constexpr bool USE_SPECIAL = true;
-}
 
-void CityGeneration::spawn_city(Canvas& p_canvas, int x, int y, int world_seed) {
-    IdRegistry* registry = IdRegistry::get_singleton();
-    if (!registry) return;
+    constexpr int MIN_SETTLEMENTS = 1; // Cities and outposts per region
+    constexpr int MAX_SETTLEMENTS = 5;
+    constexpr int SITE_ATTEMPTS = 30; // Dart throws per settlement before giving up
+    constexpr int SETTLEMENT_GAP = 4; // Free cells between neighbouring settlements
 
-    const uint32_t city_seed = static_cast<uint32_t>(world_seed) + (x * 31) + (y * 7);
+    // One settlement generated on its own canvas, centred on that canvas
+    struct SettlementJob {
+        SettlementSite site; // Centre in canvas coords
+        Canvas canvas;
+        int origin_x, origin_y; // Where the canvas lands on the region canvas
+    };
+}
+
+// Roll a city's size class and layout from its seed; outposts roll only the
+// sizes below PHASE_TRANSITION_SIZE.
+CityLayout CityGeneration::roll_layout(uint32_t city_seed, bool outpost) {
     std::mt19937 city_rng(city_seed);
-    
-    std::uniform_int_distribution<int> size_dist(MIN_CITY_SIZE, MAX_CITY_SIZE);
-    const int city_size = size_dist(city_rng);
 
-    int reach, radius, spokes, rings;
-    bool show_inner;
+    std::uniform_int_distribution<int> size_dist(MIN_CITY_SIZE, outpost ? PHASE_TRANSITION_SIZE : MAX_CITY_SIZE);
+    CityLayout layout;
+    layout.size = size_dist(city_rng);
 
     // Cities always contain outer city area
-    if (city_size <= PHASE_TRANSITION_SIZE) {
-        show_inner = false;
-        reach = city_size;
-        radius = MIN_CITY_SIZE;
-        spokes = MIN_SPOKES;
-        rings = MIN_RINGS;
+    if (layout.size <= PHASE_TRANSITION_SIZE) {
+        layout.show_inner = false;
+        layout.reach = layout.size;
+        layout.radius = MIN_CITY_SIZE;
+        layout.spokes = MIN_SPOKES;
+        layout.rings = MIN_RINGS;
     } else {
     // Cities over a certain size contain inner city area
-        show_inner = true;
-        const int size_overflow = city_size - PHASE_TRANSITION_SIZE;
+        layout.show_inner = true;
+        const int size_overflow = layout.size - PHASE_TRANSITION_SIZE;
         const float growth_progress = static_cast<float>(size_overflow) / (MAX_CITY_SIZE - PHASE_TRANSITION_SIZE);
-        
-        reach = MIN_CITY_SIZE + size_overflow; // Scales 24 -> 40
-        radius = MIN_CITY_SIZE + static_cast<int>(std::round(growth_progress * (MAX_CITY_SIZE - MIN_CITY_SIZE)));
-        spokes = MIN_SPOKES + static_cast<int>(std::round(growth_progress * (MAX_SPOKES - MIN_SPOKES)));
-        rings = MIN_RINGS + static_cast<int>(std::round(growth_progress * (MAX_RINGS - MIN_RINGS)));
+
+        layout.reach = MIN_CITY_SIZE + size_overflow; // Scales 24 -> 40
+        layout.radius = MIN_CITY_SIZE + static_cast<int>(std::round(growth_progress * (MAX_CITY_SIZE - MIN_CITY_SIZE)));
+        layout.spokes = MIN_SPOKES + static_cast<int>(std::round(growth_progress * (MAX_SPOKES - MIN_SPOKES)));
+        layout.rings = MIN_RINGS + static_cast<int>(std::round(growth_progress * (MAX_RINGS - MIN_RINGS)));
     }
-    
+
     std::uniform_int_distribution<int> radius_jitter_dist(-RADIUS_JITTER, RADIUS_JITTER);
     std::uniform_int_distribution<int> spokes_jitter_dist(-SPOKE_JITTER, SPOKE_JITTER);
-    
-    radius = std::clamp(radius + radius_jitter_dist(city_rng), MIN_CITY_SIZE, MAX_CITY_SIZE);
-    spokes = std::clamp(spokes + spokes_jitter_dist(city_rng), MIN_SPOKES, MAX_SPOKES);
-    rings = std::clamp(rings, MIN_RINGS, MAX_RINGS);
 
-    CityGeneration gen(p_canvas, city_seed, registry);
+    layout.radius = std::clamp(layout.radius + radius_jitter_dist(city_rng), MIN_CITY_SIZE, MAX_CITY_SIZE);
+    layout.spokes = std::clamp(layout.spokes + spokes_jitter_dist(city_rng), MIN_SPOKES, MAX_SPOKES);
+    layout.rings = std::clamp(layout.rings, MIN_RINGS, MAX_RINGS);
+
+    // Outer districts end about reach past the gates; leave room for their
+    // midpoint jitter and the building ring around the last road
+    const int gate_radius = layout.show_inner ? layout.radius : 3;
+    layout.extent = gate_radius + layout.reach + 4;
+    return layout;
+}
+
+// Dart-throwing Poisson-disc placement: each settlement is thrown at random
+// and kept only if it clears every placed settlement by the sum of their
+// extents plus SETTLEMENT_GAP.
+std::vector<SettlementSite> CityGeneration::plan_settlements(int gridSize, uint32_t region_seed) {
+    std::mt19937 site_rng(region_seed);
+    std::uniform_int_distribution<int> count_dist(MIN_SETTLEMENTS, MAX_SETTLEMENTS);
+    const int target = count_dist(site_rng);
+
+    // One city of any size per region, then outposts around it
+    std::vector<SettlementSite> sites;
+    for (int i = 0; i < target; ++i) {
+        SettlementSite site;
+        site.seed = CoordHash::hash(i, 0, region_seed);
+        site.layout = roll_layout(site.seed, i > 0);
+
+        // Keep the whole settlement on the canvas where it fits at all
+        const int extent = site.layout.extent;
+        const int lo = std::min(extent, gridSize / 2);
+        const int hi = std::max(gridSize - 1 - extent, gridSize / 2);
+
+        bool placed = false;
+        for (int attempt = 0; attempt < SITE_ATTEMPTS && !placed; ++attempt) {
+            std::uniform_int_distribution<int> pos_dist(lo, hi);
+            site.x = pos_dist(site_rng);
+            site.y = pos_dist(site_rng);
+            placed = std::all_of(sites.begin(), sites.end(), [&](const SettlementSite& other) {
+                const double min_dist = extent + other.layout.extent + SETTLEMENT_GAP;
+                return std::hypot(site.x - other.x, site.y - other.y) >= min_dist;
+            });
+        }
+        if (placed) sites.push_back(site);
+    }
+    return sites;
+}
+
+void CityGeneration::generate_settlement(Canvas& p_canvas, const SettlementSite& site, bool p_parallel_sectors) {
+    IdRegistry* registry = IdRegistry::get_singleton();
+    if (!registry) return;
+
+    const CityLayout& layout = site.layout;
+    CityGeneration gen(p_canvas, site.seed, registry, p_parallel_sectors);
     gen.generateCity(
-        static_cast<double>(x), static_cast<double>(y),
-        radius, spokes, rings, 
-        reach, DEFAULT_DENSITY, DEFAULT_DENSITY, 
-        show_inner, SHOW_TWIN,
+        static_cast<double>(site.x), static_cast<double>(site.y),
+        layout.radius, layout.spokes, layout.rings,
+        layout.reach, DEFAULT_DENSITY, DEFAULT_DENSITY,
+        layout.show_inner, SHOW_TWIN,
         30, 4, 6, 2, // twinRadius, twinDensity, twinSpokes, twinRings
         USE_RIVER, USE_JITTER, USE_SPECIAL
     );
-    
-    UtilityFunctions::print("City generated at (", x, ", ", y, ") | Size: ", city_size, " | Type: ", show_inner ? "Metropolis" : "Outpost");
+}
+
+void CityGeneration::_settlement_task(uint32_t p_index, uint64_t p_jobs) {
+    SettlementJob& job = (*reinterpret_cast<std::vector<SettlementJob>*>(p_jobs))[p_index];
+    generate_settlement(job.canvas, job.site);
+}
+
+// Generate every settlement of a region on its own canvas, just big enough to
+// hold it, in parallel; then composite them in plan order so the result does
+// not depend on which worker finished first.
+void CityGeneration::spawn_settlements(Canvas& p_canvas, uint32_t region_seed) {
+    IdRegistry* registry = IdRegistry::get_singleton();
+    if (!registry) return;
+    const uint16_t id_void = registry->register_string("void");
+    p_canvas.clear(id_void);
+
+    std::vector<SettlementJob> jobs;
+    for (const SettlementSite& site : plan_settlements(p_canvas.get_grid_size(), region_seed)) {
+        // The building pass stops at 0.49 of the canvas size, so pad to reach the extent
+        const int size = static_cast<int>(site.layout.extent / 0.49) + 1;
+        SettlementJob job{ site, Canvas(size), site.x - size / 2, site.y - size / 2 };
+        job.site.x = size / 2;
+        job.site.y = size / 2;
+        jobs.push_back(std::move(job));
+    }
+
+    WorkerThreadPool* pool = WorkerThreadPool::get_singleton();
+    if (pool && jobs.size() > 1) {
+        // Region tasks are low priority, so this high priority group always
+        // has threads to run on while the calling task waits
+        const int64_t group = pool->add_group_task(
+            callable_mp_static(&CityGeneration::_settlement_task).bind(reinterpret_cast<uint64_t>(&jobs)),
+            static_cast<int>(jobs.size()), -1, true, "City generation"
+        );
+        pool->wait_for_group_task_completion(group);
+    } else {
+        // A lone settlement spreads its sectors over the pool instead
+        for (SettlementJob& job : jobs) {
+            generate_settlement(job.canvas, job.site, true);
+        }
+    }
+
+    for (const SettlementJob& job : jobs) {
+        p_canvas.composite(job.canvas, job.origin_x, job.origin_y, id_void);
+    }
 }
 
 }
@@ -7,6 +7,7 @@
 #include <godot_cpp/core/math.hpp>
 #include <vector>
 #include <random>
+#include <cstdint>
 
 namespace godot {
 
@@ -15,13 +16,72 @@ struct CityNode {
     double angle;
 };
 
+// Size class and road layout rolled from a city seed
+struct CityLayout {
+    int size;
+    int radius, spokes, rings, reach;
+    bool show_inner;
+    int extent; // Distance from the centre that holds every tile of the city
+};
+
+// A city or outpost placed by the settlement scheduler
+struct SettlementSite {
+    int x, y; // Centre on the region canvas
+    uint32_t seed;
+    CityLayout layout;
+};
+
+// Counter-based random numbers: every draw is a pure function of the city
+// seed and a (stream, counter) pair, so no draw depends on the ones before it
+struct CityRandom {
+    uint64_t key;
+
+    explicit CityRandom(uint32_t seed) : key(mix(seed)) {}
+
+    // SplitMix64 finaliser
+    static uint64_t mix(uint64_t x) {
+        x += 0x9E3779B97F4A7C15ull;
+        x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ull;
+        x = (x ^ (x >> 27)) * 0x94D049BB133111EBull;
+        return x ^ (x >> 31);
+    }
+
+    uint64_t bits(uint64_t stream, uint64_t counter) const { return mix(key ^ mix(stream ^ mix(counter))); }
+    // Uniform in [0, 1)
+    double unit(uint64_t stream, uint64_t counter) const { return (bits(stream, counter) >> 11) * (1.0 / 9007199254740992.0); }
+    // Uniform in [lo, hi]
+    int range(uint64_t stream, uint64_t counter, int lo, int hi) const {
+        return lo + static_cast<int>(bits(stream, counter) % static_cast<uint64_t>(hi - lo + 1));
+    }
+};
+
 class CityGeneration {
 private:
+    // Sector bounds normalised once per line instead of once per pixel
+    struct SectorBounds {
+        double cx, cy;
+        double r_min, r_max; // Inclusive distance range, widened by half a pixel
+        double start, end; // Angles in [0, 2pi); start > end wraps through 0
+        int icx, icy; // Integer centre for polar field lookups
+        bool integral_centre;
+    };
+
+    // One annular sector to fill with alleys. Sectors only read the canvas and
+    // record the pixels they claim, so they can run in any order or in parallel.
+    struct SectorJob {
+        double cx, cy, a1, a2, r1, r2;
+        int depth;
+        uint64_t id; // Random stream of the sector
+        std::vector<int> pixels; // Canvas indices of the alley pixels
+    };
+
     Canvas& canvas;
     std::vector<double> spokeJitters;
     std::vector<double> spawnRands;
     
-    std::mt19937 rng;
+    CityRandom rng;
+    bool parallel_sectors = false;
+    std::vector<SectorJob>* pending_sectors = nullptr; // Batch being run by _sector_task
 
     uint16_t id_road;
     uint16_t id_alley;
@@ -37,21 +97,25 @@ private:
 
     class IdRegistry* registry;
 
-    double randomDouble();
     void randomize();
-    
-    bool isInSector(int px, int py, double cx, double cy, double a1, double a2, double r1, double r2);
-    bool canPlacePixel(int x, int y, uint16_t val_id);
-    void drawRestrictedLine(int x0, int y0, int x1, int y1, uint16_t val_id, double cx, double cy, double a1, double a2, double r1, double r2, uint8_t p_meta = 0);
-    void splitSector(int x, int y, int w, int h, int depth, double cx, double cy, double a1, double a2, double r1, double r2);
-    void subdivideSector(double cx, double cy, double a1, double a2, double r1, double r2, int depth);
+
+    static SectorBounds makeSector(double cx, double cy, double a1, double a2, double r1, double r2);
+    static bool isInSector(int px, int py, const SectorBounds& sector);
+    bool canPlacePixel(int x, int y, uint16_t val_id) const;
+    void drawRestrictedLine(int x0, int y0, int x1, int y1, uint16_t val_id, const SectorBounds& sector, std::vector<int>& r_pixels) const;
+    void splitSector(SectorJob& job, const SectorBounds& sector, int x, int y, int w, int h, int depth, uint64_t node) const;
+    void subdivideSector(SectorJob& job) const;
+    void runSectors(std::vector<SectorJob>& jobs);
     void drawEmptyMarketSquare(double cx, double cy, double angle, int w, int h);
     void drawEmptyGrandPlaza(double cx, double cy, double r);
-    void generateOuterDistricts(double cx, double cy, const std::vector<CityNode>& startNodes, int reach, int density);
-    bool isNearAnyRoad(int x, int y, int range);
+    void generateOuterDistricts(double cx, double cy, const std::vector<CityNode>& startNodes, int reach, int density, std::vector<SectorJob>& r_sectors);
+    void placeBuildings(double centerX, double centerY);
+
+    static void _settlement_task(uint32_t p_index, uint64_t p_jobs);
+    static void _sector_task(uint32_t p_index, uint64_t p_gen);
 
 public:
-    CityGeneration(Canvas& p_canvas, uint32_t seed, class IdRegistry* p_registry);
+    CityGeneration(Canvas& p_canvas, uint32_t seed, class IdRegistry* p_registry, bool p_parallel_sectors = false);
     
     void generateCity(
         double centerX, double centerY,
@@ -62,7 +126,11 @@ public:
         bool useRiver, bool useJitter, bool useSpecial
     );
 
-    static void spawn_city(Canvas& p_canvas, int x, int y, int world_seed);
+    static CityLayout roll_layout(uint32_t city_seed, bool outpost = false);
+    static std::vector<SettlementSite> plan_settlements(int gridSize, uint32_t region_seed);
+    static void generate_settlement(Canvas& p_canvas, const SettlementSite& site, bool p_parallel_sectors = false);
+
+    static void spawn_settlements(Canvas& p_canvas, uint32_t region_seed);
 };
 
 }
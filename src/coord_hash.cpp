@@ -0,0 +1,148 @@
+#include "coord_hash.h"
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define COORD_HASH_X86
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#define COORD_HASH_TARGET(t)
+#else
+#define COORD_HASH_TARGET(t) __attribute__((target(t)))
+#endif
+#endif
+
+namespace godot {
+
+// Along a row only x changes, so x * X_MUL is stepped by addition: lane i
+// starts at (x0 + i) * X_MUL and advances by lanes * X_MUL. Unsigned wraparound
+// keeps this bit-identical to the multiply.
+
+static void hash_row_scalar(int x0, int y, uint32_t seed, uint32_t* out, int count) {
+    const uint32_t row = (static_cast<uint32_t>(y) * CoordHash::Y_MUL) ^ seed;
+    uint32_t xh = static_cast<uint32_t>(x0) * CoordHash::X_MUL;
+    for (int i = 0; i < count; i++) {
+        out[i] = xh ^ row;
+        xh += CoordHash::X_MUL;
+    }
+}
+
+#ifdef COORD_HASH_X86
+
+COORD_HASH_TARGET("sse2")
+static void hash_row_sse2(int x0, int y, uint32_t seed, uint32_t* out, int count) {
+    const uint32_t row = (static_cast<uint32_t>(y) * CoordHash::Y_MUL) ^ seed;
+    const uint32_t xh = static_cast<uint32_t>(x0) * CoordHash::X_MUL;
+    const uint32_t m = CoordHash::X_MUL;
+
+    __m128i lanes = _mm_setr_epi32(
+        static_cast<int>(xh), static_cast<int>(xh + m),
+        static_cast<int>(xh + 2 * m), static_cast<int>(xh + 3 * m));
+    const __m128i step = _mm_set1_epi32(static_cast<int>(4 * m));
+    const __m128i row_v = _mm_set1_epi32(static_cast<int>(row));
+
+    int i = 0;
+    for (; i + 4 <= count; i += 4) {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_xor_si128(lanes, row_v));
+        lanes = _mm_add_epi32(lanes, step);
+    }
+    hash_row_scalar(x0 + i, y, seed, out + i, count - i);
+}
+
+COORD_HASH_TARGET("avx2")
+static void hash_row_avx2(int x0, int y, uint32_t seed, uint32_t* out, int count) {
+    const uint32_t row = (static_cast<uint32_t>(y) * CoordHash::Y_MUL) ^ seed;
+    const uint32_t xh = static_cast<uint32_t>(x0) * CoordHash::X_MUL;
+    const uint32_t m = CoordHash::X_MUL;
+
+    __m256i lanes = _mm256_setr_epi32(
+        static_cast<int>(xh), static_cast<int>(xh + m),
+        static_cast<int>(xh + 2 * m), static_cast<int>(xh + 3 * m),
+        static_cast<int>(xh + 4 * m), static_cast<int>(xh + 5 * m),
+        static_cast<int>(xh + 6 * m), static_cast<int>(xh + 7 * m));
+    const __m256i step = _mm256_set1_epi32(static_cast<int>(8 * m));
+    const __m256i row_v = _mm256_set1_epi32(static_cast<int>(row));
+
+    int i = 0;
+    for (; i + 8 <= count; i += 8) {
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), _mm256_xor_si256(lanes, row_v));
+        lanes = _mm256_add_epi32(lanes, step);
+    }
+    hash_row_scalar(x0 + i, y, seed, out + i, count - i);
+}
+
+static bool cpu_has_sse2() {
+#if defined(__x86_64__) || defined(_M_X64)
+    return true;
+#elif defined(_MSC_VER)
+    int info[4];
+    __cpuid(info, 1);
+    return (info[3] & (1 << 26)) != 0;
+#else
+    return __builtin_cpu_supports("sse2");
+#endif
+}
+
+static bool cpu_has_avx2() {
+#if defined(_MSC_VER)
+    int info[4];
+    __cpuid(info, 1);
+    const bool osxsave = (info[2] & (1 << 27)) != 0;
+    if (!osxsave || (_xgetbv(0) & 0x6) != 0x6) return false;
+    __cpuidex(info, 7, 0);
+    return (info[1] & (1 << 5)) != 0;
+#else
+    return __builtin_cpu_supports("avx2");
+#endif
+}
+
+#endif // COORD_HASH_X86
+
+bool CoordHash::is_supported(Path path) {
+    switch (path) {
+        case PATH_SCALAR: return true;
+#ifdef COORD_HASH_X86
+        case PATH_SSE2: {
+            static const bool supported = cpu_has_sse2();
+            return supported;
+        }
+        case PATH_AVX2: {
+            static const bool supported = cpu_has_avx2();
+            return supported;
+        }
+#endif
+        default: return false;
+    }
+}
+
+CoordHash::Path CoordHash::get_best_path() {
+    static const Path best = is_supported(PATH_AVX2) ? PATH_AVX2 : (is_supported(PATH_SSE2) ? PATH_SSE2 : PATH_SCALAR);
+    return best;
+}
+
+const char* CoordHash::get_path_name(Path path) {
+    switch (path) {
+        case PATH_SSE2: return "sse2";
+        case PATH_AVX2: return "avx2";
+        default: return "scalar";
+    }
+}
+
+void CoordHash::hash_row(int x0, int y, uint32_t seed, uint32_t* out, int count) {
+    hash_row(get_best_path(), x0, y, seed, out, count);
+}
+
+void CoordHash::hash_row(Path path, int x0, int y, uint32_t seed, uint32_t* out, int count) {
+#ifdef COORD_HASH_X86
+    if (path == PATH_AVX2 && is_supported(PATH_AVX2)) {
+        hash_row_avx2(x0, y, seed, out, count);
+        return;
+    }
+    if (path == PATH_SSE2 && is_supported(PATH_SSE2)) {
+        hash_row_sse2(x0, y, seed, out, count);
+        return;
+    }
+#endif
+    hash_row_scalar(x0, y, seed, out, count);
+}
+
+}
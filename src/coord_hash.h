@@ -0,0 +1,40 @@
+#ifndef SPACETRAVELLER_COORD_HASH_H
+#define SPACETRAVELLER_COORD_HASH_H
+
+#include <cstdint>
+
+namespace godot {
+
+// Coordinate hash used for procedural placement: (x * A) ^ (y * B) ^ seed.
+// hash_row hashes a run of consecutive x on one row at once, using SSE2 or
+// AVX2 when the CPU supports them. Every path is bit-identical to hash().
+class CoordHash {
+public:
+    static constexpr uint32_t X_MUL = 1597334677U;
+    static constexpr uint32_t Y_MUL = 3812015801U;
+
+    enum Path {
+        PATH_SCALAR = 0,
+        PATH_SSE2 = 1,
+        PATH_AVX2 = 2
+    };
+
+    static inline uint32_t hash(int x, int y, uint32_t seed) {
+        return (static_cast<uint32_t>(x) * X_MUL) ^
+               (static_cast<uint32_t>(y) * Y_MUL) ^
+               seed;
+    }
+
+    // out[i] = hash(x0 + i, y, seed) for i in [0, count), on the best supported path
+    static void hash_row(int x0, int y, uint32_t seed, uint32_t* out, int count);
+    // Same, forcing a path (falls back to scalar if unsupported)
+    static void hash_row(Path path, int x0, int y, uint32_t seed, uint32_t* out, int count);
+
+    static bool is_supported(Path path);
+    static Path get_best_path();
+    static const char* get_path_name(Path path);
+};
+
+}
+
+#endif // SPACETRAVELLER_COORD_HASH_H
@@ -26,6 +26,15 @@ IdRegistry::IdRegistry() {}
 IdRegistry::~IdRegistry() {}
 
 uint16_t IdRegistry::register_string(const String &p_string) {
+    {
+        std::shared_lock<std::shared_mutex> lock(mutex);
+        auto it = string_to_id.find(p_string);
+        if (it != string_to_id.end()) {
+            return it->second;
+        }
+    }
+
+    std::unique_lock<std::shared_mutex> lock(mutex);
     auto it = string_to_id.find(p_string);
     if (it != string_to_id.end()) {
         return it->second;
@@ -38,6 +47,7 @@ uint16_t IdRegistry::register_string(const String &p_string) {
 }
 
 uint16_t IdRegistry::get_id(const String &p_string) const {
+    std::shared_lock<std::shared_mutex> lock(mutex);
     auto it = string_to_id.find(p_string);
     if (it != string_to_id.end()) {
         return it->second;
@@ -46,6 +56,7 @@ uint16_t IdRegistry::get_id(const String &p_string) const {
 }
 
 String IdRegistry::get_string(uint16_t p_id) const {
+    std::shared_lock<std::shared_mutex> lock(mutex);
     if (p_id < id_to_string.size()) {
         return id_to_string[p_id];
     }
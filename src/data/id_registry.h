@@ -5,6 +5,8 @@
 #include <godot_cpp/variant/string.hpp>
 #include <unordered_map>
 #include <vector>
+#include <shared_mutex>
+#include <mutex>
 #include "database.h"
 
 namespace godot {
@@ -14,6 +16,8 @@ class IdRegistry : public Object {
 
 private:
     static IdRegistry *singleton;
+    // Region generation reads and registers ids from worker threads
+    mutable std::shared_mutex mutex;
     std::unordered_map<String, uint16_t, StringHasher> string_to_id;
     std::vector<String> id_to_string;
 
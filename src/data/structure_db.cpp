@@ -18,15 +18,26 @@ void StructureDb::_bind_methods() {
     ClassDB::bind_method(D_METHOD("get_palette", "id"), &StructureDb::get_palette);
 }
 
+// Source cell of chunk-local (x, y) for a structure placed with the given orientation
+static void rotate_local(uint8_t p_rotation, int p_x, int p_y, int p_max, int &r_x, int &r_y) {
+    switch (p_rotation) {
+        case WorldGeneration::ROT_WEST: r_x = p_y; r_y = p_max - p_x; break;
+        case WorldGeneration::ROT_NORTH: r_x = p_max - p_x; r_y = p_max - p_y; break;
+        case WorldGeneration::ROT_EAST: r_x = p_max - p_y; r_y = p_x; break;
+        default: r_x = p_x; r_y = p_y; break;
+    }
+}
+
 StructureDb::StructureDb() {}
 StructureDb::~StructureDb() {}
 
 StructureInfo StructureDb::_parse_row(const Dictionary &p_data) {
     IdRegistry* id_reg = IdRegistry::get_singleton();
         StructureInfo info;
+    uint16_t handle = 0;
         
     if (id_reg) {
-        id_reg->register_string(p_data["id"]);
+        handle = id_reg->register_string(p_data["id"]);
     }
 
     info.blueprint = p_data.get("blueprint", "");
@@ -69,6 +80,25 @@ StructureInfo StructureDb::_parse_row(const Dictionary &p_data) {
                 info.data[current_pos++] = tile_id;
             }
         }
+
+    info.rotated.resize(4 * total_tiles);
+    for (int rot = 0; rot < 4; rot++) {
+        uint16_t* dst = &info.rotated[rot * total_tiles];
+        for (int y = 0; y < CHUNK_SIZE; y++) {
+            for (int x = 0; x < CHUNK_SIZE; x++) {
+                int sx, sy;
+                rotate_local(static_cast<uint8_t>(rot), x, y, CHUNK_SIZE - 1, sx, sy);
+                dst[y * CHUNK_SIZE + x] = info.data[sy * CHUNK_SIZE + sx];
+            }
+        }
+    }
+
+    if (id_reg) {
+        if (handle >= fast_cache.size()) {
+            fast_cache.resize(handle + 1);
+        }
+        fast_cache[handle] = info;
+    }
     return info;
 }
 
@@ -92,4 +122,13 @@ uint16_t StructureDb::get_tile_at(const String &p_structure_id, int p_x, int p_y
     return info->data[idx];
 }
 
+bool StructureDb::has_structure(uint16_t p_handle) const {
+    return p_handle < fast_cache.size() && !fast_cache[p_handle].rotated.empty();
+}
+
+const uint16_t* StructureDb::get_rotated_tiles(uint16_t p_handle, uint8_t p_rotation) const {
+    if (!has_structure(p_handle)) return nullptr;
+    return &fast_cache[p_handle].rotated[(p_rotation & 0x03) * CHUNK_SIZE * CHUNK_SIZE];
+}
+
 }
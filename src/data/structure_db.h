@@ -9,6 +9,8 @@ namespace godot {
 
 struct StructureInfo {
     std::vector<uint16_t> data;
+    // data pre-rotated for each chunk orientation (S/W/N/E), one CHUNK_SIZE^2 block each
+    std::vector<uint16_t> rotated;
     String blueprint;
     Array palette;
 };
@@ -23,6 +25,9 @@ protected:
     static void _bind_methods();
     virtual StructureInfo _parse_row(const Dictionary &p_data) override;
 
+    // Indexed by the structure's IdRegistry id, which serves as its handle
+    std::vector<StructureInfo> fast_cache;
+
 public:
     StructureDb();
     ~StructureDb();
@@ -35,6 +40,9 @@ public:
 
     // Fast C++ access
     uint16_t get_tile_at(const String &p_structure_id, int p_x, int p_y) const;
+    bool has_structure(uint16_t p_handle) const;
+    // Row-major tiles of the structure as placed with the given orientation, or nullptr
+    const uint16_t* get_rotated_tiles(uint16_t p_handle, uint8_t p_rotation) const;
 };
 
 }
@@ -25,6 +25,8 @@ TileInfo TileDb::_parse_row(const Dictionary &p_data) {
     TileInfo info;
     info.atlas = variant_to_vector2i(p_data.get("atlas", Array()));
     info.solid = p_data.get("solid", false);
+    info.opaque = p_data.get("opaque", info.solid);
+    info.walkable = p_data.get("walkable", !info.solid);
     
     if (IdRegistry::get_singleton()) {
         uint16_t id = IdRegistry::get_singleton()->register_string(p_data["id"]);
@@ -9,6 +9,8 @@ namespace godot {
 struct TileInfo {
     Vector2i atlas;
     bool solid;
+    bool opaque;   // Blocks line of sight (defaults to solid)
+    bool walkable; // Can be walked over (defaults to !solid)
 };
 
 class TileDb : public Object, public DataBase<TileInfo, TileDb> {
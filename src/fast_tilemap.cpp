@@ -4,7 +4,10 @@
 #include <godot_cpp/classes/rendering_server.hpp>
 #include <godot_cpp/classes/engine.hpp>
 #include <godot_cpp/variant/utility_functions.hpp>
+#include <godot_cpp/variant/transform2d.hpp>
 #include <queue>
+#include <algorithm>
+#include <cstdlib>
 
 using namespace godot;
 
@@ -13,13 +16,22 @@ void FastTileMap::_bind_methods() {
     ClassDB::bind_method(D_METHOD("get_tilesheet"), &FastTileMap::get_tilesheet);
     ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "tilesheet", PROPERTY_HINT_RESOURCE_TYPE, "Texture2D"), "set_tilesheet", "get_tilesheet");
 
+    ClassDB::bind_method(D_METHOD("set_batched_rendering", "enabled"), &FastTileMap::set_batched_rendering);
+    ClassDB::bind_method(D_METHOD("is_batched_rendering"), &FastTileMap::is_batched_rendering);
+    ADD_PROPERTY(PropertyInfo(Variant::BOOL, "batched_rendering"), "set_batched_rendering", "is_batched_rendering");
+
     ClassDB::bind_method(D_METHOD("init_world_bubble", "playerPos", "is_square"), &FastTileMap::init_world_bubble, DEFVAL(false));
     ClassDB::bind_method(D_METHOD("place_tile", "x", "y", "tile_id"), &FastTileMap::place_tile);
     ClassDB::bind_method(D_METHOD("get_tile_at", "x", "y"), &FastTileMap::get_tile_at);
     ClassDB::bind_method(D_METHOD("fill_tiles", "x", "y", "tile_id", "mask", "invert_mask", "contiguous"), &FastTileMap::fill_tiles, DEFVAL(Rect2i()), DEFVAL(false), DEFVAL(true));
     ClassDB::bind_method(D_METHOD("clear_cache"), &FastTileMap::clear_cache);
+    ClassDB::bind_method(D_METHOD("is_cell_opaque", "x", "y"), &FastTileMap::is_cell_opaque);
+    ClassDB::bind_method(D_METHOD("is_cell_walkable", "x", "y"), &FastTileMap::is_cell_walkable);
+    ClassDB::bind_method(D_METHOD("get_seen_mask", "region"), &FastTileMap::get_seen_mask);
     ClassDB::bind_method(D_METHOD("get_tile_id_cache"), &FastTileMap::get_tile_id_cache);
     ClassDB::bind_method(D_METHOD("set_tile_id_cache", "cache"), &FastTileMap::set_tile_id_cache);
+    ClassDB::bind_method(D_METHOD("get_tile_data"), &FastTileMap::get_tile_data);
+    ClassDB::bind_method(D_METHOD("set_tile_data", "data"), &FastTileMap::set_tile_data);
 
     ClassDB::bind_method(D_METHOD("get_spacing"), &FastTileMap::get_spacing);
     ClassDB::bind_method(D_METHOD("get_cell_size"), &FastTileMap::get_cell_size);
@@ -28,17 +40,14 @@ void FastTileMap::_bind_methods() {
     ClassDB::bind_method(D_METHOD("set_world_bubble_size", "size"), &FastTileMap::set_world_bubble_size);
     ClassDB::bind_method(D_METHOD("get_world_bubble_size"), &FastTileMap::get_world_bubble_size);
     ClassDB::bind_method(D_METHOD("get_world_bubble_radius"), &FastTileMap::get_world_bubble_radius);
+    ClassDB::bind_method(D_METHOD("get_render_call_count"), &FastTileMap::get_render_call_count);
 }
 
 FastTileMap::FastTileMap() {
 }
 
 FastTileMap::~FastTileMap() {
-    RenderingServer* rs = RenderingServer::get_singleton();
-    for (auto& pair : tile_rids) {
-        rs->free_rid(pair.second);
-    }
-    tile_rids.clear();
+    free_world_bubble();
 }
 
 void FastTileMap::set_tilesheet(const Ref<Texture2D>& texture) {
@@ -49,80 +58,371 @@ Ref<Texture2D> FastTileMap::get_tilesheet() const {
     return tilesheet;
 }
 
+void FastTileMap::set_batched_rendering(bool p_enabled) {
+    if (batched_rendering == p_enabled) return;
+    batched_rendering = p_enabled;
+    rebuild_world_bubble();
+}
+
 void FastTileMap::set_world_bubble_size(int p_size) {
+    ERR_FAIL_COND_MSG(p_size <= 0, "World bubble size must be positive.");
+    if (world_bubble_size == p_size) return;
     world_bubble_size = p_size;
     world_bubble_radius = p_size / 2;
+    rebuild_world_bubble();
 }
 
-void FastTileMap::init_world_bubble(const Vector2i& playerPos, bool is_square) {
+// Slots, batches and spans depend on the bubble size and render mode; an
+// existing bubble is recreated around the same centre, keeping all cell data
+void FastTileMap::rebuild_world_bubble() {
+    if (!bubble_root.is_valid()) return;
+
+    free_world_bubble();
+    dirty_cells.clear();
+    build_world_bubble();
+    scroll_world_bubble(bubble_center, true);
+}
+
+void FastTileMap::free_world_bubble() {
     RenderingServer* rs = RenderingServer::get_singleton();
-    RID parent_rid = get_canvas_item();
-    
+    for (TileSlot& slot : tile_slots) {
+        if (slot.rid.is_valid()) rs->free_rid(slot.rid);
+    }
+    tile_slots.clear();
+
+    for (TileBatch& batch : tile_batches) {
+        rs->free_rid(batch.rid);
+    }
+    tile_batches.clear();
+
+    if (bubble_root.is_valid()) {
+        rs->free_rid(bubble_root);
+        bubble_root = RID();
+    }
+    bubble_valid = false;
+}
+
+void FastTileMap::init_world_bubble(const Vector2i& playerPos, bool is_square) {
     // Clear any existing tiles
-    for (auto& pair : tile_rids) {
-        rs->free_rid(pair.second);
+    free_world_bubble();
+    clear_cells();
+    seen_cells.clear();
+    dirty_cells.clear();
+
+    bubble_square = is_square;
+    build_world_bubble();
+    bubble_center = playerPos;
+}
+
+// Canvas items and visible spans for the current size, shape and render mode
+void FastTileMap::build_world_bubble() {
+    RenderingServer* rs = RenderingServer::get_singleton();
+
+    // All slots hang off one root item; scrolling only moves its transform
+    bubble_root = rs->canvas_item_create();
+    rs->canvas_item_set_parent(bubble_root, get_canvas_item());
+
+    // Visible offset range per row: the full square, or the span inside the radius
+    bubble_spans.assign(world_bubble_size, Vector2i(-world_bubble_radius, world_bubble_size - world_bubble_radius));
+    if (!bubble_square) {
+        const int r2 = world_bubble_radius * world_bubble_radius;
+        for (int i = 0; i < world_bubble_size; i++) {
+            int oy = i - world_bubble_radius;
+            int k = -1;
+            while ((k + 1) * (k + 1) + oy * oy < r2) k++;
+            if (k < 0) {
+                bubble_spans[i] = Vector2i(0, 0);
+            } else {
+                bubble_spans[i] = Vector2i(std::max(-k, -world_bubble_radius), std::min(k + 1, world_bubble_size - world_bubble_radius));
+            }
+        }
+    }
+
+    // Create one slot per cell of the bubble square
+    tile_slots.resize(world_bubble_size * world_bubble_size);
+    if (batched_rendering) {
+        // Enough batches that any bubble position maps to distinct ring entries
+        batches_per_axis = (world_bubble_size + BATCH_SIZE - 1) / BATCH_SIZE + 1;
+        tile_batches.resize(batches_per_axis * batches_per_axis);
+        for (TileBatch& batch : tile_batches) {
+            batch.rid = rs->canvas_item_create();
+            rs->canvas_item_set_parent(batch.rid, bubble_root);
+        }
+    } else {
+        for (TileSlot& slot : tile_slots) {
+            slot.rid = rs->canvas_item_create();
+            slot.visible = true;
+            rs->canvas_item_set_parent(slot.rid, bubble_root);
+        }
     }
-    tile_rids.clear();
+}
+
+void FastTileMap::set_cell_id(int x, int y, uint16_t tile_id) {
+    tile_id_cache.set(x, y, tile_id);
+    set_cell_flags(x, y, tile_id);
+}
+
+void FastTileMap::set_cell_flags(int x, int y, uint16_t tile_id) {
+    TileDb* tile_db = TileDb::get_singleton();
+    const TileInfo* info = tile_db ? tile_db->get_tile_info(tile_id) : nullptr;
+    opaque_cells.set(x, y, info && info->opaque);
+    walkable_cells.set(x, y, info && info->walkable);
+}
+
+void FastTileMap::clear_cells() {
     tile_id_cache.clear();
-    seen_cells.clear();
-    
-    // Create tiles in circular or square bubble
-    for (int i = 0; i < world_bubble_size * world_bubble_size; i++) {
-        int ox = (i / world_bubble_size) - world_bubble_radius;
-        int oy = (i % world_bubble_size) - world_bubble_radius;
-        
-        // Check if within radius
-        float dist = sqrtf(static_cast<float>(ox * ox + oy * oy));
-        if (is_square || dist < static_cast<float>(world_bubble_radius)) {
-            uint64_t offsetKey = Occlusion::pack_coords(ox, oy);
-            
-            // Create canvas item for this tile
-            RID tile_rid = rs->canvas_item_create();
-            rs->canvas_item_set_parent(tile_rid, parent_rid);
-            tile_rids[offsetKey] = tile_rid;
+    opaque_cells.clear();
+    walkable_cells.clear();
+}
+
+bool FastTileMap::is_in_span(int cx, int cy, const Vector2i& center) const {
+    int oy = cy - center.y + world_bubble_radius;
+    if (oy < 0 || oy >= world_bubble_size) return false;
+    const Vector2i& span = bubble_spans[oy];
+    int ox = cx - center.x;
+    return ox >= span.x && ox < span.y;
+}
+
+void FastTileMap::set_slot_visible(TileSlot& slot, bool p_visible, RenderingServer* rs) {
+    if (slot.visible == p_visible) return;
+    slot.visible = p_visible;
+    if (batched_rendering) {
+        mark_batch_dirty(slot.cell.x, slot.cell.y);
+    } else {
+        rs->canvas_item_set_visible(slot.rid, p_visible);
+        render_call_count++;
+    }
+}
+
+void FastTileMap::set_slot_modulate(TileSlot& slot, const Color& p_color, RenderingServer* rs) {
+    if (batched_rendering) {
+        if (slot.modulate == p_color) return;
+        slot.modulate = p_color;
+        mark_batch_dirty(slot.cell.x, slot.cell.y);
+    } else {
+        slot.modulate = p_color;
+        rs->canvas_item_set_modulate(slot.rid, p_color);
+        render_call_count++;
+    }
+}
+
+void FastTileMap::clear_slot(TileSlot& slot, RenderingServer* rs) {
+    slot.has_tile = false;
+    if (batched_rendering) {
+        mark_batch_dirty(slot.cell.x, slot.cell.y);
+    } else {
+        rs->canvas_item_clear(slot.rid);
+        render_call_count++;
+    }
+}
+
+void FastTileMap::mark_batch_dirty(int cx, int cy, bool claim) {
+    int bx = (cx >= 0) ? (cx / BATCH_SIZE) : ((cx - (BATCH_SIZE - 1)) / BATCH_SIZE);
+    int by = (cy >= 0) ? (cy / BATCH_SIZE) : ((cy - (BATCH_SIZE - 1)) / BATCH_SIZE);
+    int rx = bx % batches_per_axis; if (rx < 0) rx += batches_per_axis;
+    int ry = by % batches_per_axis; if (ry < 0) ry += batches_per_axis;
+
+    TileBatch& batch = tile_batches[ry * batches_per_axis + rx];
+    if (batch.coord != Vector2i(bx, by)) {
+        // A block that no longer owns its ring entry has nothing left to redraw
+        if (!claim) return;
+        // Ring entry now covers a different block; the old one has left the bubble
+        batch.coord = Vector2i(bx, by);
+    }
+    batch.dirty = true;
+}
+
+// Rebuild the command list of every dirty batch: one rect per visible cell,
+// with the per-cell fog modulate baked into the rect colour
+void FastTileMap::flush_batches(RenderingServer* rs, RID texture_rid) {
+    if (!batched_rendering) return;
+
+    const int x0 = bubble_center.x - world_bubble_radius;
+    const int y0 = bubble_center.y - world_bubble_radius;
+    const int x1 = x0 + world_bubble_size;
+    const int y1 = y0 + world_bubble_size;
+    const int cell_size = get_cell_size();
+
+    for (TileBatch& batch : tile_batches) {
+        if (!batch.dirty) continue;
+        batch.dirty = false;
+
+        rs->canvas_item_clear(batch.rid);
+        render_call_count++;
+
+        const int bx0 = std::max(batch.coord.x * BATCH_SIZE, x0);
+        const int by0 = std::max(batch.coord.y * BATCH_SIZE, y0);
+        const int bx1 = std::min(batch.coord.x * BATCH_SIZE + BATCH_SIZE, x1);
+        const int by1 = std::min(batch.coord.y * BATCH_SIZE + BATCH_SIZE, y1);
+
+        for (int cy = by0; cy < by1; cy++) {
+            for (int cx = bx0; cx < bx1; cx++) {
+                const TileSlot& slot = tile_slots[get_slot_index(cx, cy)];
+                if (!slot.visible || !slot.has_tile || slot.cell != Vector2i(cx, cy)) continue;
+
+                rs->canvas_item_add_texture_rect_region(
+                    batch.rid,
+                    Rect2(cx * cell_size, cy * cell_size, TILE_SIZE, TILE_SIZE),
+                    texture_rid,
+                    Rect2(slot.atlas_pos.x, slot.atlas_pos.y, TILE_SIZE, TILE_SIZE),
+                    slot.modulate
+                );
+                render_call_count++;
+            }
         }
     }
 }
 
-void FastTileMap::update_tile_at(int ox, int oy, const Vector2i& playerPos, uint16_t tile_id, RenderingServer* rs, RID texture_rid, TileDb* tile_db) {
-    uint64_t offsetKey = Occlusion::pack_coords(ox, oy);
-    auto it_rid = tile_rids.find(offsetKey);
-    if (it_rid == tile_rids.end()) return;
-    
-    RID tile_rid = it_rid->second;
-    
-    Vector2i atlas_pos(1, 1);
-    const TileInfo* info = tile_db->get_tile_info(tile_id);
-    if (info) {
-        atlas_pos.x = 1 + info->atlas.x * (TILE_SIZE + 1);
-        atlas_pos.y = 1 + info->atlas.y * (TILE_SIZE + 1);
+void FastTileMap::scroll_world_bubble(const Vector2i& center, bool force_redraw) {
+    if (!tilesheet.is_valid() || tile_slots.empty()) return;
+
+    RenderingServer* rs = RenderingServer::get_singleton();
+    RID texture_rid = tilesheet->get_rid();
+    TileDb* tile_db = TileDb::get_singleton();
+    if (!tile_db) return;
+
+    render_call_count = 0;
+
+    const int size = world_bubble_size;
+    const int radius = world_bubble_radius;
+    const Vector2i old_center = bubble_center;
+    const int dx = center.x - old_center.x;
+    const int dy = center.y - old_center.y;
+
+    const bool full_redraw = force_redraw || !bubble_valid || std::abs(dx) >= size || std::abs(dy) >= size;
+
+    const int nx0 = center.x - radius, ny0 = center.y - radius;
+    const int ox0 = old_center.x - radius, oy0 = old_center.y - radius;
+
+    // Render newly exposed cells (every cell on a full redraw)
+    for (int cy = ny0; cy < ny0 + size; cy++) {
+        bool row_exposed = full_redraw || cy < oy0 || cy >= oy0 + size;
+        int x_begin = nx0, x_end = nx0 + size;
+        if (!row_exposed) {
+            // Only the strip not covered by the previous square
+            if (dx > 0) {
+                x_begin = ox0 + size;
+            } else if (dx < 0) {
+                x_end = ox0;
+            } else {
+                continue;
+            }
+        }
+
+        for (int cx = x_begin; cx < x_end; cx++) {
+            TileSlot& slot = tile_slots[get_slot_index(cx, cy)];
+            if (batched_rendering) {
+                // The departing cell's batch must drop it, unless that block
+                // already gave its ring entry to one inside the bubble
+                mark_batch_dirty(slot.cell.x, slot.cell.y, false);
+                mark_batch_dirty(cx, cy);
+            }
+            slot.cell = Vector2i(cx, cy);
+            render_cell(slot, cx, cy, rs, texture_rid, tile_db);
+            set_slot_visible(slot, is_in_span(cx, cy, center), rs);
+        }
+    }
+
+    // Cells that stay in the square only change visibility where the row spans moved
+    if (!full_redraw && (dx != 0 || dy != 0)) {
+        for (int cy = std::max(ny0, oy0); cy < std::min(ny0, oy0) + size; cy++) {
+            const Vector2i& new_span = bubble_spans[cy - ny0];
+            const Vector2i& old_span = bubble_spans[cy - oy0];
+            int a0 = old_center.x + old_span.x, b0 = old_center.x + old_span.y;
+            int a1 = center.x + new_span.x, b1 = center.x + new_span.y;
+
+            auto update_range = [&](int from, int to) {
+                from = std::max(from, std::max(nx0, ox0));
+                to = std::min(to, std::min(nx0, ox0) + size);
+                for (int cx = from; cx < to; cx++) {
+                    set_slot_visible(tile_slots[get_slot_index(cx, cy)], is_in_span(cx, cy, center), rs);
+                }
+            };
+            update_range(std::min(a0, a1), std::max(a0, a1));
+            update_range(std::min(b0, b1), std::max(b0, b1));
+        }
+    }
+
+    // Re-render edited cells still inside the bubble
+    for (const Vector2i& cell : dirty_cells) {
+        if (cell.x < nx0 || cell.x >= nx0 + size || cell.y < ny0 || cell.y >= ny0 + size) continue;
+        render_cell(tile_slots[get_slot_index(cell.x, cell.y)], cell.x, cell.y, rs, texture_rid, tile_db);
+    }
+    dirty_cells.clear();
+
+    if (full_redraw || dx != 0 || dy != 0) {
+        rs->canvas_item_set_transform(bubble_root, Transform2D(0.0f, Vector2(-center.x * get_cell_size(), -center.y * get_cell_size())));
+        render_call_count++;
+    }
+
+    bubble_center = center;
+    bubble_valid = true;
+}
+
+void FastTileMap::invalidate_cell(int x, int y) {
+    if (bubble_valid) {
+        dirty_cells.push_back(Vector2i(x, y));
+    }
+}
+
+void FastTileMap::render_cell(TileSlot& slot, int cx, int cy, RenderingServer* rs, RID texture_rid, TileDb* tile_db) {
+    uint16_t tile_id = tile_id_cache.get(cx, cy);
+    if (tile_id != 0 && tile_id != TileGrid::EMPTY) {
+        update_tile_at(slot, cx, cy, tile_id, rs, texture_rid, tile_db);
+    } else {
+        clear_slot(slot, rs);
     }
-    
+}
+
+void FastTileMap::draw_atlas_rect(TileSlot& slot, int cx, int cy, const Vector2i& atlas, RenderingServer* rs, RID texture_rid) {
+    Vector2i atlas_pos(1 + atlas.x * (TILE_SIZE + 1), 1 + atlas.y * (TILE_SIZE + 1));
+
+    if (batched_rendering) {
+        if (!slot.has_tile || slot.atlas_pos != atlas_pos) {
+            slot.atlas_pos = atlas_pos;
+            slot.has_tile = true;
+            mark_batch_dirty(cx, cy);
+        }
+        return;
+    }
+
+    slot.atlas_pos = atlas_pos;
+    slot.has_tile = true;
+
     // Clear and render tile
-    rs->canvas_item_clear(tile_rid);
+    rs->canvas_item_clear(slot.rid);
     rs->canvas_item_add_texture_rect_region(
-        tile_rid,
-        Rect2(ox * get_cell_size(), oy * get_cell_size(), TILE_SIZE, TILE_SIZE),
+        slot.rid,
+        Rect2(cx * get_cell_size(), cy * get_cell_size(), TILE_SIZE, TILE_SIZE),
         texture_rid,
         Rect2(atlas_pos.x, atlas_pos.y, TILE_SIZE, TILE_SIZE)
     );
+    render_call_count += 2;
+}
+
+void FastTileMap::update_tile_at(TileSlot& slot, int cx, int cy, uint16_t tile_id, RenderingServer* rs, RID texture_rid, TileDb* tile_db) {
+    Vector2i atlas(0, 0);
+    const TileInfo* info = tile_db->get_tile_info(tile_id);
+    if (info) {
+        atlas = info->atlas;
+    }
+    draw_atlas_rect(slot, cx, cy, atlas, rs, texture_rid);
 }
 
 void FastTileMap::place_tile(int x, int y, const String& tile_id) {
-    uint64_t cellKey = Occlusion::pack_coords(x, y);
     IdRegistry* id_reg = IdRegistry::get_singleton();
     if (id_reg) {
-        tile_id_cache[cellKey] = id_reg->get_id(tile_id);
+        set_cell_id(x, y, id_reg->get_id(tile_id));
+        invalidate_cell(x, y);
     }
 }
 
-String FastTileMap::get_tile_at(int x, int y) const {
-    uint64_t cellKey = Occlusion::pack_coords(x, y);
-    auto it = tile_id_cache.find(cellKey);
-    if (it != tile_id_cache.end()) {
+String FastTileMap::get_tile_at(int x, int y) {
+    uint16_t tile_id = get_cell_id(x, y);
+    if (tile_id != TileGrid::EMPTY) {
         IdRegistry* id_reg = IdRegistry::get_singleton();
         if (id_reg) {
-            return id_reg->get_string(it->second);
+            return id_reg->get_string(tile_id);
         }
     }
     return "void";
@@ -133,16 +433,15 @@ void FastTileMap::fill_tiles(int x, int y, const String& tile_id, const Rect2i&
     if (!id_reg) return;
 
     uint16_t new_id = id_reg->get_id(tile_id);
-    uint16_t target_id = 0;
-
-    uint64_t startKey = Occlusion::pack_coords(x, y);
-    auto it = tile_id_cache.find(startKey);
-    if (it != tile_id_cache.end()) {
-        target_id = it->second;
+    uint16_t target_id = get_cell_id(x, y);
+    if (target_id == TileGrid::EMPTY) {
+        target_id = 0;
     }
 
     if (new_id == target_id) return;
 
+    invalidate_world_bubble();
+
     int radius = world_bubble_radius;
     bool has_mask = mask.size.x > 0 && mask.size.y > 0;
 
@@ -166,15 +465,13 @@ void FastTileMap::fill_tiles(int x, int y, const String& tile_id, const Rect2i&
                 }
             }
 
-            uint64_t key = Occlusion::pack_coords(p.x, p.y);
-            uint16_t current_id = 0;
-            auto it_cur = tile_id_cache.find(key);
-            if (it_cur != tile_id_cache.end()) {
-                current_id = it_cur->second;
+            uint16_t current_id = get_cell_id(p.x, p.y);
+            if (current_id == TileGrid::EMPTY) {
+                current_id = 0;
             }
 
             if (current_id == target_id) {
-                tile_id_cache[key] = new_id;
+                set_cell_id(p.x, p.y, new_id);
                 q.push(Vector2i(p.x + 1, p.y));
                 q.push(Vector2i(p.x - 1, p.y));
                 q.push(Vector2i(p.x, p.y + 1));
@@ -197,39 +494,87 @@ void FastTileMap::fill_tiles(int x, int y, const String& tile_id, const Rect2i&
                     }
                 }
 
-                uint64_t key = Occlusion::pack_coords(gx, gy);
-                uint16_t current_id = 0;
-                auto it_cur = tile_id_cache.find(key);
-                if (it_cur != tile_id_cache.end()) {
-                    current_id = it_cur->second;
+                uint16_t current_id = get_cell_id(gx, gy);
+                if (current_id == TileGrid::EMPTY) {
+                    current_id = 0;
                 }
 
                 if (current_id == target_id) {
-                    tile_id_cache[key] = new_id;
+                    set_cell_id(gx, gy, new_id);
                 }
             }
         }
     }
 }
 
+// Row-major mask of the region, one byte per cell: 255 if seen, 0 otherwise.
+// Matches Image::FORMAT_L8 so the map can upload it directly.
+PackedByteArray FastTileMap::get_seen_mask(const Rect2i& p_region) const {
+    PackedByteArray mask;
+    if (p_region.size.x <= 0 || p_region.size.y <= 0) return mask;
+
+    mask.resize(static_cast<int64_t>(p_region.size.x) * p_region.size.y);
+    uint8_t* out = mask.ptrw();
+
+    const int x0 = p_region.position.x;
+    const int x1 = x0 + p_region.size.x;
+    for (int y = 0; y < p_region.size.y; y++) {
+        const int cy = p_region.position.y + y;
+        uint8_t* row = out + static_cast<int64_t>(y) * p_region.size.x;
+
+        // Walk the row one 64-cell word at a time
+        int cx = x0;
+        while (cx < x1) {
+            const int word_end = std::min((cx & ~BitGrid::PAGE_MASK) + BitGrid::PAGE_SIZE, x1);
+            const uint64_t word = seen_cells.get_word(cx, cy);
+            for (; cx < word_end; cx++) {
+                row[cx - x0] = ((word >> (cx & BitGrid::PAGE_MASK)) & 1) ? 255 : 0;
+            }
+        }
+    }
+    return mask;
+}
+
 void FastTileMap::clear_cache() {
-    tile_id_cache.clear();
+    clear_cells();
+    invalidate_world_bubble();
 }
 
 Dictionary FastTileMap::get_tile_id_cache() const {
     Dictionary d;
-    for (auto const& [key, val] : tile_id_cache) {
-        d[key] = (int)val;
-    }
+    tile_id_cache.for_each([&](int x, int y, uint16_t val) {
+        d[Occlusion::pack_coords(x, y)] = (int)val;
+    });
     return d;
 }
 
 void FastTileMap::set_tile_id_cache(const Dictionary &p_cache) {
-    tile_id_cache.clear();
+    clear_cells();
+    invalidate_world_bubble();
     Array keys = p_cache.keys();
     for (int i = 0; i < keys.size(); i++) {
         uint64_t key = keys[i];
-        tile_id_cache[key] = (uint16_t)((int)p_cache[keys[i]]);
+        int x = static_cast<int>(static_cast<int32_t>(key >> 32));
+        int y = static_cast<int>(static_cast<int32_t>(key & 0xFFFFFFFF));
+        set_cell_id(x, y, (uint16_t)((int)p_cache[keys[i]]));
     }
 }
 
+// Placed tiles as one binary blob of whole pages (see TileGrid::serialize),
+// so snapshots cost bytes rather than one Variant per cell
+PackedByteArray FastTileMap::get_tile_data() const {
+    PackedByteArray data;
+    data.resize(static_cast<int64_t>(tile_id_cache.get_serialized_size()));
+    tile_id_cache.serialize(data.ptrw());
+    return data;
+}
+
+void FastTileMap::set_tile_data(const PackedByteArray &p_data) {
+    clear_cells();
+    invalidate_world_bubble();
+    ERR_FAIL_COND_MSG(!tile_id_cache.deserialize(p_data.ptr(), static_cast<size_t>(p_data.size())), "Invalid tile data.");
+
+    tile_id_cache.for_each([&](int x, int y, uint16_t tile_id) {
+        set_cell_flags(x, y, tile_id);
+    });
+}
@@ -8,10 +8,14 @@
 #include <godot_cpp/variant/vector2i.hpp>
 #include <godot_cpp/variant/rid.hpp>
 #include <godot_cpp/variant/color.hpp>
+#include <godot_cpp/variant/rect2i.hpp>
+#include <godot_cpp/variant/packed_byte_array.hpp>
 #include <unordered_map>
-#include <unordered_set>
+#include <vector>
 #include "data/tile_db.h"
 #include "occlusion.h"
+#include "tile_grid.h"
+#include "bit_grid.h"
 
 namespace godot {
 
@@ -22,17 +26,87 @@ protected:
     static void _bind_methods();
 
     static const int TILE_SIZE = 12;
+    static const int BATCH_SIZE = 24; // Matches the world chunk size
 
     int world_bubble_size = 64;
     int world_bubble_radius = 32;
     int spacing = 0;
 
-    std::unordered_map<uint64_t, RID> tile_rids;
-    std::unordered_map<uint64_t, uint16_t> tile_id_cache;
-    std::unordered_set<uint64_t> seen_cells;
+    enum FogState : uint8_t {
+        FOG_NONE,
+        FOG_VISIBLE,
+        FOG_SEEN,
+        FOG_UNSEEN
+    };
+
+    // World-anchored tile slot. Slots form a toroidal ring buffer indexed by
+    // world cell modulo the bubble size, so scrolling only touches exposed cells.
+    struct TileSlot {
+        RID rid; // Per-tile mode only
+        Vector2i cell;
+        Vector2i atlas_pos;
+        Color modulate = Color(1.0f, 1.0f, 1.0f, 1.0f);
+        uint8_t fog_state = FOG_NONE; // State last issued to the RenderingServer
+        bool has_tile = false;
+        bool visible = false;
+    };
+
+    // Batched mode: one canvas item per BATCH_SIZE block, also kept as a ring
+    struct TileBatch {
+        RID rid;
+        Vector2i coord;
+        bool dirty = false;
+    };
+
+    bool batched_rendering = false;
+    int batches_per_axis = 0;
+    std::vector<TileBatch> tile_batches;
+
+    RID bubble_root;
+    bool bubble_square = false; // Shape passed to init_world_bubble, kept for rebuilds
+    std::vector<TileSlot> tile_slots;
+    std::vector<Vector2i> bubble_spans; // Per row offset: visible [x, y) offset range
+    std::vector<Vector2i> dirty_cells;
+    Vector2i bubble_center;
+    bool bubble_valid = false;
+    int render_call_count = 0; // RenderingServer calls issued by the last bubble update
+
+    TileGrid tile_id_cache; // Explicitly placed tiles (edits); never evicted
+    // Tile properties of the cells seen so far, updated by set_cell_flags
+    BitGrid opaque_cells;
+    BitGrid walkable_cells;
+    BitGrid seen_cells; // Fog of war: 1 bit per cell ever seen
 
     Ref<Texture2D> tilesheet;
 
+    inline int get_slot_index(int cx, int cy) const {
+        int sx = cx % world_bubble_size; if (sx < 0) sx += world_bubble_size;
+        int sy = cy % world_bubble_size; if (sy < 0) sy += world_bubble_size;
+        return sy * world_bubble_size + sx;
+    }
+    void set_cell_id(int x, int y, uint16_t tile_id);
+    void set_cell_flags(int x, int y, uint16_t tile_id);
+    // Effective tile of a cell, TileGrid::EMPTY if there is none
+    virtual uint16_t get_cell_id(int x, int y) { return tile_id_cache.get(x, y); }
+    void clear_cells();
+
+    bool is_in_span(int cx, int cy, const Vector2i& center) const;
+    void set_slot_visible(TileSlot& slot, bool p_visible, RenderingServer* rs);
+    void set_slot_modulate(TileSlot& slot, const Color& p_color, RenderingServer* rs);
+    void clear_slot(TileSlot& slot, RenderingServer* rs);
+    void free_world_bubble();
+    void build_world_bubble();
+    void rebuild_world_bubble();
+
+    void mark_batch_dirty(int cx, int cy, bool claim = true);
+    void flush_batches(RenderingServer* rs, RID texture_rid);
+
+    void scroll_world_bubble(const Vector2i& center, bool force_redraw = false);
+    void invalidate_cell(int x, int y);
+    void invalidate_world_bubble() { bubble_valid = false; }
+    virtual void render_cell(TileSlot& slot, int cx, int cy, RenderingServer* rs, RID texture_rid, TileDb* tile_db);
+    void draw_atlas_rect(TileSlot& slot, int cx, int cy, const Vector2i& atlas, RenderingServer* rs, RID texture_rid);
+
 public:
     FastTileMap();
     ~FastTileMap();
@@ -44,19 +118,30 @@ public:
     int get_cell_size() const { return TILE_SIZE + spacing; }
 
     static int get_tile_size() { return TILE_SIZE; }
+    void set_batched_rendering(bool p_enabled);
+    bool is_batched_rendering() const { return batched_rendering; }
+
     void set_world_bubble_size(int p_size);
     int get_world_bubble_size() const { return world_bubble_size; }
     int get_world_bubble_radius() const { return world_bubble_radius; }
+    int get_render_call_count() const { return render_call_count; }
 
     void init_world_bubble(const Vector2i& playerPos, bool is_square = false);
-    void update_tile_at(int ox, int oy, const Vector2i& playerPos, uint16_t tile_id, RenderingServer* rs, RID texture_rid, TileDb* tile_db);
+    void update_tile_at(TileSlot& slot, int cx, int cy, uint16_t tile_id, RenderingServer* rs, RID texture_rid, TileDb* tile_db);
     void place_tile(int x, int y, const String& tile_id);
-    String get_tile_at(int x, int y) const;
+    String get_tile_at(int x, int y);
     void fill_tiles(int x, int y, const String& tile_id, const Rect2i& mask = Rect2i(), bool invert_mask = false, bool p_contiguous = true);
     void clear_cache();
 
+    bool is_cell_opaque(int x, int y) const { return opaque_cells.get(x, y); }
+    bool is_cell_walkable(int x, int y) const { return walkable_cells.get(x, y); }
+
+    PackedByteArray get_seen_mask(const Rect2i& p_region) const;
+
     Dictionary get_tile_id_cache() const;
     void set_tile_id_cache(const Dictionary &p_cache);
+    PackedByteArray get_tile_data() const;
+    void set_tile_data(const PackedByteArray &p_data);
 };
 
 }
@@ -1,5 +1,4 @@
 #include "occlusion.h"
-#include "data/tile_db.h"
 #include <cstdlib>
 
 namespace godot {
@@ -7,22 +6,13 @@ namespace godot {
 bool Occlusion::is_occluded(
     const Vector2i& cellPos,
     const Vector2i& playerPos,
-    const std::unordered_map<uint64_t, uint16_t>& tile_cache
+    const BitGrid& opaque_cells
 ) {
-    TileDb* p_tile_db = TileDb::get_singleton();
-    if (!p_tile_db) return false;
-
     // Player's own tile is never occluded
     if (cellPos == playerPos) {
         return false;
     }
     
-    // Check if cell exists in cache
-    uint64_t cellKey = pack_coords(cellPos.x, cellPos.y);
-    if (tile_cache.find(cellKey) == tile_cache.end()) {
-        return false;
-    }
-    
     // Bresenham's line algorithm
     int x0 = playerPos.x, y0 = playerPos.y;
     int x1 = cellPos.x, y1 = cellPos.y;
@@ -44,12 +34,8 @@ bool Occlusion::is_occluded(
             }
             
             // Check if this intermediate cell is a wall
-            auto it = tile_cache.find(pack_coords(x, y));
-            if (it != tile_cache.end()) {
-                const TileInfo* info = p_tile_db->get_tile_info(it->second);
-                if (info && info->solid) {
-                    return true;  // Wall blocks line of sight
-                }
+            if (opaque_cells.get(x, y)) {
+                return true;  // Wall blocks line of sight
             }
         }
         
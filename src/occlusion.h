@@ -3,13 +3,12 @@
 
 #include <godot_cpp/variant/vector2i.hpp>
 #include <godot_cpp/variant/string.hpp>
-#include <unordered_map>
 #include <cstdint>
+#include <vector>
+#include "bit_grid.h"
 
 namespace godot {
 
-class TileDb;
-
 class Occlusion {
 public:
     // Pack two int32s into a uint64 key
@@ -18,14 +17,109 @@ public:
                static_cast<uint64_t>(static_cast<uint32_t>(y));
     }
     
-    // Check if a cell is occluded from the player using Bresenham's line algorithm
+    // Single-ray query: check if a cell is occluded from the player using Bresenham's line algorithm.
+    // Cells outside the known opacity grid count as transparent.
     static bool is_occluded(
         const Vector2i& cellPos,
         const Vector2i& playerPos,
-        const std::unordered_map<uint64_t, uint16_t>& tile_cache
+        const BitGrid& opaque_cells
     );
 };
 
+// Symmetric recursive shadowcasting over a (2r+1)^2 window around an origin.
+// The whole visibility set is computed in one sweep into a bit-packed bitmap
+// that render passes can query per cell.
+class FieldOfView {
+private:
+    struct Slope {
+        int num, den; // den > 0
+    };
+
+    Vector2i origin;
+    int radius = 0;
+    int span = 0;
+    int words_per_row = 0;
+    std::vector<uint64_t> bits;
+
+    static inline int floor_div(int a, int b) {
+        int q = a / b;
+        return (a % b != 0 && ((a < 0) != (b < 0))) ? q - 1 : q;
+    }
+    static inline int ceil_div(int a, int b) { return -floor_div(-a, b); }
+
+    inline void mark(int x, int y) {
+        int lx = x - origin.x + radius;
+        int ly = y - origin.y + radius;
+        if (lx < 0 || lx >= span || ly < 0 || ly >= span) return;
+        bits[ly * words_per_row + (lx >> 6)] |= (uint64_t(1) << (lx & 63));
+    }
+
+    static inline Vector2i transform(int quadrant, const Vector2i& o, int depth, int col) {
+        switch (quadrant) {
+            case 0: return Vector2i(o.x + col, o.y - depth); // North
+            case 1: return Vector2i(o.x + depth, o.y + col); // East
+            case 2: return Vector2i(o.x + col, o.y + depth); // South
+            default: return Vector2i(o.x - depth, o.y + col); // West
+        }
+    }
+
+    template <typename IsOpaque>
+    void scan(int quadrant, int depth, Slope start, Slope end, IsOpaque& is_opaque) {
+        if (depth > radius) return;
+
+        // Columns whose centre lies within [start, end], ties rounded inwards
+        const int min_col = floor_div(2 * depth * start.num + start.den, 2 * start.den);
+        const int max_col = ceil_div(2 * depth * end.num - end.den, 2 * end.den);
+
+        int prev = -1; // -1: none, 0: floor, 1: wall
+        for (int col = min_col; col <= max_col; col++) {
+            Vector2i p = transform(quadrant, origin, depth, col);
+            const bool wall = is_opaque(p.x, p.y);
+            const bool symmetric = col * start.den >= depth * start.num && col * end.den <= depth * end.num;
+
+            if (wall || symmetric) {
+                mark(p.x, p.y);
+            }
+            if (prev == 1 && !wall) {
+                start = Slope{2 * col - 1, 2 * depth};
+            }
+            if (prev == 0 && wall) {
+                scan(quadrant, depth + 1, start, Slope{2 * col - 1, 2 * depth}, is_opaque);
+            }
+            prev = wall ? 1 : 0;
+        }
+        if (prev == 0) {
+            scan(quadrant, depth + 1, start, end, is_opaque);
+        }
+    }
+
+public:
+    // is_opaque(x, y) -> bool, in world coordinates
+    template <typename IsOpaque>
+    void compute(const Vector2i& p_origin, int p_radius, IsOpaque&& is_opaque) {
+        origin = p_origin;
+        radius = p_radius;
+        span = 2 * p_radius + 1;
+        words_per_row = (span + 63) >> 6;
+        bits.assign(static_cast<size_t>(span) * words_per_row, 0);
+
+        mark(origin.x, origin.y);
+        for (int quadrant = 0; quadrant < 4; quadrant++) {
+            scan(quadrant, 1, Slope{-1, 1}, Slope{1, 1}, is_opaque);
+        }
+    }
+
+    inline bool is_visible(int x, int y) const {
+        int lx = x - origin.x + radius;
+        int ly = y - origin.y + radius;
+        if (lx < 0 || lx >= span || ly < 0 || ly >= span) return false;
+        return (bits[ly * words_per_row + (lx >> 6)] >> (lx & 63)) & 1;
+    }
+
+    const Vector2i& get_origin() const { return origin; }
+    int get_radius() const { return radius; }
+};
+
 }
 
 #endif // SPACETRAVELLER_OCCLUSION_H
@@ -0,0 +1,63 @@
+#include "region_file.h"
+
+namespace godot {
+
+static constexpr size_t HEADER_BYTES = 5 * sizeof(uint32_t);
+
+std::vector<uint8_t> RegionFile::Writer::finish(int32_t region_x, int32_t region_y) const {
+    const size_t table_bytes = sections.size() * sizeof(Section);
+    const uint32_t base = static_cast<uint32_t>(HEADER_BYTES + table_bytes);
+
+    std::vector<uint8_t> out(HEADER_BYTES + table_bytes + body.size());
+    uint8_t* cursor = out.data();
+    auto put = [&](const void* src, size_t count) {
+        std::memcpy(cursor, src, count);
+        cursor += count;
+    };
+
+    const uint32_t count = static_cast<uint32_t>(sections.size());
+    put(&MAGIC, sizeof(MAGIC));
+    put(&VERSION, sizeof(VERSION));
+    put(&region_x, sizeof(region_x));
+    put(&region_y, sizeof(region_y));
+    put(&count, sizeof(count));
+    for (const Section& section : sections) {
+        const Section entry = { section.tag, base + section.offset, section.size };
+        put(&entry, sizeof(entry));
+    }
+    if (!body.empty()) {
+        put(body.data(), body.size());
+    }
+    return out;
+}
+
+bool RegionFile::parse(const uint8_t* data, size_t size, int32_t& r_region_x, int32_t& r_region_y, std::vector<Section>& r_sections) {
+    Reader header(data, size);
+    const uint32_t magic = header.read<uint32_t>();
+    const uint32_t version = header.read<uint32_t>();
+    r_region_x = header.read<int32_t>();
+    r_region_y = header.read<int32_t>();
+    const uint32_t count = header.read<uint32_t>();
+    if (!header.is_valid() || magic != MAGIC || version != VERSION) return false;
+    // Check the count against the bytes left before allocating for it
+    if (count > header.get_remaining() / sizeof(Section)) return false;
+
+    r_sections.resize(count);
+    for (uint32_t i = 0; i < count; i++) {
+        header.read_bytes(&r_sections[i], sizeof(Section));
+        if (!header.is_valid()) return false;
+        if (static_cast<uint64_t>(r_sections[i].offset) + r_sections[i].size > size) return false;
+    }
+    return true;
+}
+
+RegionFile::Reader RegionFile::get_section(const uint8_t* data, const std::vector<Section>& sections, uint32_t tag) {
+    for (const Section& section : sections) {
+        if (section.tag == tag) {
+            return Reader(data + section.offset, section.size);
+        }
+    }
+    return Reader(nullptr, 0);
+}
+
+}
@@ -0,0 +1,115 @@
+#ifndef SPACETRAVELLER_REGION_FILE_H
+#define SPACETRAVELLER_REGION_FILE_H
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+
+namespace godot {
+
+// Four-character code stored as a little-endian uint32
+constexpr uint32_t region_file_tag(char a, char b, char c, char d) {
+    return static_cast<uint32_t>(static_cast<uint8_t>(a)) |
+           (static_cast<uint32_t>(static_cast<uint8_t>(b)) << 8) |
+           (static_cast<uint32_t>(static_cast<uint8_t>(c)) << 16) |
+           (static_cast<uint32_t>(static_cast<uint8_t>(d)) << 24);
+}
+
+// Versioned, sectioned binary container for a saved region.
+// Layout (native byte order): magic, version, region x/y, section count,
+// a table of { tag, offset, size } entries, then the section payloads.
+// Sections are located through the table, so a reader can skip what it
+// does not need and newer sections can be added without breaking old ones.
+class RegionFile {
+public:
+    static constexpr uint32_t MAGIC = region_file_tag('S', 'T', 'R', 'G');
+    static constexpr uint32_t VERSION = 1;
+
+    static constexpr uint32_t SECTION_PALETTE = region_file_tag('P', 'A', 'L', 'T'); // Id -> name strings
+    static constexpr uint32_t SECTION_CHUNKS = region_file_tag('C', 'H', 'N', 'K');  // Chunk ids, rotations, biomes
+    static constexpr uint32_t SECTION_EDITS = region_file_tag('E', 'D', 'I', 'T');   // Per-chunk edit overlays
+    static constexpr uint32_t SECTION_SEEN = region_file_tag('S', 'E', 'E', 'N');    // Fog-of-war bit pages
+    static constexpr uint32_t SECTION_ITEMS = region_file_tag('I', 'T', 'E', 'M');   // Dropped item stacks
+
+    struct Section {
+        uint32_t tag;
+        uint32_t offset;
+        uint32_t size;
+    };
+
+    // Appends sections into one buffer
+    class Writer {
+    private:
+        std::vector<uint8_t> body;
+        std::vector<Section> sections;
+
+    public:
+        void begin_section(uint32_t tag) { sections.push_back({ tag, static_cast<uint32_t>(body.size()), 0 }); }
+        void end_section() { sections.back().size = static_cast<uint32_t>(body.size()) - sections.back().offset; }
+
+        template <typename T>
+        void write(const T& value) { write_bytes(&value, sizeof(T)); }
+        void write_bytes(const void* data, size_t size) {
+            const uint8_t* bytes = static_cast<const uint8_t*>(data);
+            body.insert(body.end(), bytes, bytes + size);
+        }
+
+        void patch(size_t section_position, const void* data, size_t size) {
+            std::memcpy(body.data() + sections.back().offset + section_position, data, size);
+        }
+
+        std::vector<uint8_t> finish(int32_t region_x, int32_t region_y) const;
+    };
+
+    // Bounds-checked cursor over one section; reads past the end fail softly
+    class Reader {
+    private:
+        const uint8_t* data = nullptr;
+        size_t size = 0;
+        size_t position = 0;
+        bool valid = true;
+
+    public:
+        Reader() = default;
+        Reader(const uint8_t* p_data, size_t p_size) : data(p_data), size(p_size) {}
+
+        template <typename T>
+        T read() {
+            T value{};
+            read_bytes(&value, sizeof(T));
+            return value;
+        }
+        void read_bytes(void* out, size_t count) {
+            if (!valid || position + count > size) {
+                valid = false;
+                return;
+            }
+            std::memcpy(out, data + position, count);
+            position += count;
+        }
+        // Pointer to the next count bytes without copying, or nullptr
+        const uint8_t* view(size_t count) {
+            if (!valid || position + count > size) {
+                valid = false;
+                return nullptr;
+            }
+            const uint8_t* ptr = data + position;
+            position += count;
+            return ptr;
+        }
+
+        bool is_valid() const { return valid; }
+        size_t get_size() const { return size; }
+        size_t get_remaining() const { return valid ? size - position : 0; }
+        const uint8_t* get_data() const { return data; }
+    };
+
+    // Validates the header and section table; on success r_sections covers the buffer
+    static bool parse(const uint8_t* data, size_t size, int32_t& r_region_x, int32_t& r_region_y, std::vector<Section>& r_sections);
+    static Reader get_section(const uint8_t* data, const std::vector<Section>& sections, uint32_t tag);
+};
+
+}
+
+#endif // SPACETRAVELLER_REGION_FILE_H
@@ -31,34 +31,10 @@ StructureEditor::~StructureEditor() {
 }
 
 void StructureEditor::update_visuals(const Vector2i& centerPos) {
-    if (!tilesheet.is_valid()) return;
-    
-    RenderingServer* rs = RenderingServer::get_singleton();
-    RID texture_rid = tilesheet->get_rid();
-    TileDb* tile_db = TileDb::get_singleton();
-    if (!tile_db) return;
-
-    for (auto& pair : tile_rids) {
-        uint64_t offsetKey = pair.first;
-        int ox = static_cast<int>(static_cast<int32_t>(offsetKey >> 32));
-        int oy = static_cast<int>(static_cast<int32_t>(offsetKey & 0xFFFFFFFF));
-        
-        int cx = ox + centerPos.x;
-        int cy = oy + centerPos.y;
-        uint64_t cellKey = Occlusion::pack_coords(cx, cy);
-        
-        uint16_t tile_id = 0; // void
-        auto it = tile_id_cache.find(cellKey);
-        if (it != tile_id_cache.end()) {
-            tile_id = it->second;
-        }
-
-        if (tile_id != 0) {
-            update_tile_at(ox, oy, centerPos, tile_id, rs, texture_rid, tile_db);
-            rs->canvas_item_set_modulate(pair.second, Color(1, 1, 1, 1));
-        } else {
-            rs->canvas_item_clear(pair.second);
-        }
+    // The editor grid is small; always redraw it fully
+    scroll_world_bubble(centerPos, true);
+    if (tilesheet.is_valid()) {
+        flush_batches(RenderingServer::get_singleton(), tilesheet->get_rid());
     }
 }
 
@@ -92,11 +68,10 @@ Dictionary StructureEditor::export_to_rle(const String &p_id) const {
     IdRegistry* id_reg = IdRegistry::get_singleton();
     for (int y = -size/2; y < size/2; y++) {
         for (int x = -size/2; x < size/2; x++) {
-            uint64_t key = Occlusion::pack_coords(x, y);
             String tile_id = "void";
-            auto it = tile_id_cache.find(key);
-            if (it != tile_id_cache.end()) {
-                if (id_reg) tile_id = id_reg->get_string(it->second);
+            uint16_t cached_id = tile_id_cache.get(x, y);
+            if (cached_id != TileGrid::EMPTY) {
+                if (id_reg) tile_id = id_reg->get_string(cached_id);
             }
 
             if (tile_id == current_id) {
@@ -120,7 +95,8 @@ Dictionary StructureEditor::export_to_rle(const String &p_id) const {
 }
 
 void StructureEditor::import_from_rle(const String &p_blueprint, const Array &p_palette) {
-    tile_id_cache.clear();
+    clear_cells();
+    invalidate_world_bubble();
     
     IdRegistry* id_reg = IdRegistry::get_singleton();
     if (!id_reg) return;
@@ -159,8 +135,7 @@ void StructureEditor::import_from_rle(const String &p_blueprint, const Array &p_
             int y = (current_pos / size) - size/2;
             
             if (tile_id != 0) {
-                uint64_t key = Occlusion::pack_coords(x, y);
-                tile_id_cache[key] = tile_id;
+                set_cell_id(x, y, tile_id);
             }
             current_pos++;
         }
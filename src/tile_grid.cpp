@@ -0,0 +1,117 @@
+#include "tile_grid.h"
+#include <algorithm>
+#include <cstring>
+
+namespace godot {
+
+TileGrid::Page* TileGrid::find_page(int px, int py) const {
+    uint64_t key = page_key(px, py);
+    if (last_page && last_page_key == key) {
+        return last_page;
+    }
+
+    auto it = pages.find(key);
+    if (it == pages.end()) {
+        return nullptr;
+    }
+
+    last_page_key = key;
+    last_page = it->second.get();
+    return last_page;
+}
+
+TileGrid::Page* TileGrid::get_or_create_page(int px, int py) {
+    Page* page = find_page(px, py);
+    if (page) return page;
+
+    std::unique_ptr<Page> new_page = std::make_unique<Page>();
+    std::fill(std::begin(new_page->cells), std::end(new_page->cells), EMPTY);
+
+    uint64_t key = page_key(px, py);
+    page = new_page.get();
+    pages[key] = std::move(new_page);
+
+    last_page_key = key;
+    last_page = page;
+    return page;
+}
+
+void TileGrid::erase_pages(int x0, int y0, int x1, int y1) {
+    for (auto it = pages.begin(); it != pages.end();) {
+        const int px = static_cast<int>(static_cast<int32_t>(it->first >> 32));
+        const int py = static_cast<int>(static_cast<int32_t>(it->first & 0xFFFFFFFF));
+        const bool inside = (px << PAGE_SHIFT) >= x0 && ((px + 1) << PAGE_SHIFT) <= x1 &&
+                            (py << PAGE_SHIFT) >= y0 && ((py + 1) << PAGE_SHIFT) <= y1;
+        it = inside ? pages.erase(it) : std::next(it);
+    }
+    last_page = nullptr;
+    last_page_key = 0;
+}
+
+void TileGrid::clear() {
+    pages.clear();
+    last_page = nullptr;
+    last_page_key = 0;
+}
+
+bool TileGrid::is_page_empty(const Page& page) {
+    for (int i = 0; i < PAGE_CELLS; i++) {
+        if (page.cells[i] != EMPTY) return false;
+    }
+    return true;
+}
+
+// Layout: uint32 version, uint32 page count, then per page int32 px, int32 py
+// and PAGE_CELLS uint16 cells, all in native byte order
+static constexpr size_t HEADER_BYTES = 2 * sizeof(uint32_t);
+static constexpr size_t PAGE_BYTES = 2 * sizeof(int32_t) + TileGrid::PAGE_CELLS * sizeof(uint16_t);
+
+size_t TileGrid::get_serialized_size() const {
+    size_t count = 0;
+    for (const auto& pair : pages) {
+        if (!is_page_empty(*pair.second)) count++;
+    }
+    return HEADER_BYTES + count * PAGE_BYTES;
+}
+
+void TileGrid::serialize(uint8_t* out) const {
+    uint8_t* cursor = out + HEADER_BYTES;
+    uint32_t count = 0;
+    for (const auto& pair : pages) {
+        if (is_page_empty(*pair.second)) continue;
+        const int32_t px = static_cast<int32_t>(pair.first >> 32);
+        const int32_t py = static_cast<int32_t>(pair.first & 0xFFFFFFFF);
+        std::memcpy(cursor, &px, sizeof(px));
+        std::memcpy(cursor + sizeof(px), &py, sizeof(py));
+        std::memcpy(cursor + 2 * sizeof(int32_t), pair.second->cells, sizeof(pair.second->cells));
+        cursor += PAGE_BYTES;
+        count++;
+    }
+
+    const uint32_t version = SERIALIZE_VERSION;
+    std::memcpy(out, &version, sizeof(version));
+    std::memcpy(out + sizeof(uint32_t), &count, sizeof(count));
+}
+
+bool TileGrid::deserialize(const uint8_t* data, size_t size) {
+    clear();
+    if (size < HEADER_BYTES) return false;
+
+    uint32_t version, count;
+    std::memcpy(&version, data, sizeof(version));
+    std::memcpy(&count, data + sizeof(uint32_t), sizeof(count));
+    if (version != SERIALIZE_VERSION || size != HEADER_BYTES + count * PAGE_BYTES) return false;
+
+    const uint8_t* cursor = data + HEADER_BYTES;
+    for (uint32_t i = 0; i < count; i++) {
+        int32_t px, py;
+        std::memcpy(&px, cursor, sizeof(px));
+        std::memcpy(&py, cursor + sizeof(px), sizeof(py));
+        Page* page = get_or_create_page(px, py);
+        std::memcpy(page->cells, cursor + 2 * sizeof(int32_t), sizeof(page->cells));
+        cursor += PAGE_BYTES;
+    }
+    return true;
+}
+
+}
@@ -0,0 +1,99 @@
+#ifndef SPACETRAVELLER_TILE_GRID_H
+#define SPACETRAVELLER_TILE_GRID_H
+
+#include <unordered_map>
+#include <memory>
+#include <cstdint>
+#include <cstddef>
+
+namespace godot {
+
+// Paged dense grid of tile ids.
+// Cells are stored in 32x32 pages of uint16_t (2 bytes per cell), found through
+// a small page directory keyed by page coordinates. Unset cells read as EMPTY.
+class TileGrid {
+public:
+    static constexpr int PAGE_SHIFT = 5;
+    static constexpr int PAGE_SIZE = 1 << PAGE_SHIFT;
+    static constexpr int PAGE_MASK = PAGE_SIZE - 1;
+    static constexpr int PAGE_CELLS = PAGE_SIZE * PAGE_SIZE;
+    static constexpr uint16_t EMPTY = 0xFFFF;
+
+    struct Page {
+        uint16_t cells[PAGE_CELLS];
+    };
+
+private:
+    std::unordered_map<uint64_t, std::unique_ptr<Page>> pages;
+
+    // Performance Cache: Last Page
+    mutable uint64_t last_page_key = 0;
+    mutable Page* last_page = nullptr;
+
+    static inline uint64_t page_key(int px, int py) {
+        return (static_cast<uint64_t>(static_cast<uint32_t>(px)) << 32) |
+               static_cast<uint64_t>(static_cast<uint32_t>(py));
+    }
+
+    static bool is_page_empty(const Page& page);
+    Page* find_page(int px, int py) const;
+    Page* get_or_create_page(int px, int py);
+
+public:
+    TileGrid() = default;
+    TileGrid(const TileGrid&) = delete;
+    TileGrid& operator=(const TileGrid&) = delete;
+
+    inline uint16_t get(int x, int y) const {
+        const Page* page = find_page(x >> PAGE_SHIFT, y >> PAGE_SHIFT);
+        if (!page) return EMPTY;
+        return page->cells[((y & PAGE_MASK) << PAGE_SHIFT) | (x & PAGE_MASK)];
+    }
+
+    inline bool has(int x, int y) const { return get(x, y) != EMPTY; }
+
+    inline void set(int x, int y, uint16_t id) {
+        Page* page = get_or_create_page(x >> PAGE_SHIFT, y >> PAGE_SHIFT);
+        page->cells[((y & PAGE_MASK) << PAGE_SHIFT) | (x & PAGE_MASK)] = id;
+    }
+
+    inline void erase(int x, int y) {
+        Page* page = find_page(x >> PAGE_SHIFT, y >> PAGE_SHIFT);
+        if (page) page->cells[((y & PAGE_MASK) << PAGE_SHIFT) | (x & PAGE_MASK)] = EMPTY;
+    }
+
+    void clear();
+    // Drops every page lying entirely inside the cell rect [x0, x1) x [y0, y1);
+    // a page-aligned rect is cleared completely
+    void erase_pages(int x0, int y0, int x1, int y1);
+
+    // Binary snapshot of the grid: a header (version, page count), then per
+    // page its coords and raw cells. Pages with no set cell are skipped.
+    static constexpr uint32_t SERIALIZE_VERSION = 1;
+    size_t get_serialized_size() const;
+    void serialize(uint8_t* out) const;
+    // Replaces the grid with a snapshot; returns false (leaving it empty) if malformed
+    bool deserialize(const uint8_t* data, size_t size);
+
+    size_t get_page_count() const { return pages.size(); }
+    size_t get_memory_usage() const { return pages.size() * (sizeof(Page) + sizeof(uint64_t) + sizeof(void*)); }
+
+    // Visits every non-empty cell as f(x, y, id)
+    template <typename F>
+    void for_each(F&& f) const {
+        for (const auto& pair : pages) {
+            const int bx = static_cast<int>(static_cast<int32_t>(pair.first >> 32)) << PAGE_SHIFT;
+            const int by = static_cast<int>(static_cast<int32_t>(pair.first & 0xFFFFFFFF)) << PAGE_SHIFT;
+            const uint16_t* cells = pair.second->cells;
+            for (int i = 0; i < PAGE_CELLS; i++) {
+                if (cells[i] != EMPTY) {
+                    f(bx + (i & PAGE_MASK), by + (i >> PAGE_SHIFT), cells[i]);
+                }
+            }
+        }
+    }
+};
+
+}
+
+#endif // SPACETRAVELLER_TILE_GRID_H
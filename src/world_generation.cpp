@@ -1,6 +1,15 @@
 #include "world_generation.h"
 #include "data/structure_db.h"
 #include "data/id_registry.h"
+#include "region_file.h"
+#include <godot_cpp/classes/worker_thread_pool.hpp>
+#include <godot_cpp/classes/time.hpp>
+#include <godot_cpp/classes/file_access.hpp>
+#include <godot_cpp/variant/vector3.hpp>
+#include <godot_cpp/variant/callable_method_pointer.hpp>
+#include <algorithm>
+#include <map>
+#include <cstring>
 
 using namespace godot;
 
@@ -13,6 +22,19 @@ void WorldGeneration::_bind_methods() {
     ClassDB::bind_method(D_METHOD("set_world_seed", "seed"), &WorldGeneration::set_world_seed);
     ClassDB::bind_method(D_METHOD("get_world_seed"), &WorldGeneration::get_world_seed);
     ADD_PROPERTY(PropertyInfo(Variant::INT, "world_seed"), "set_world_seed", "get_world_seed");
+
+    ClassDB::bind_method(D_METHOD("set_max_resident_regions", "count"), &WorldGeneration::set_max_resident_regions);
+    ClassDB::bind_method(D_METHOD("get_max_resident_regions"), &WorldGeneration::get_max_resident_regions);
+    ADD_PROPERTY(PropertyInfo(Variant::INT, "max_resident_regions"), "set_max_resident_regions", "get_max_resident_regions");
+
+    ClassDB::bind_method(D_METHOD("set_prefetch_margin", "chunks"), &WorldGeneration::set_prefetch_margin);
+    ClassDB::bind_method(D_METHOD("get_prefetch_margin"), &WorldGeneration::get_prefetch_margin);
+    ADD_PROPERTY(PropertyInfo(Variant::INT, "prefetch_margin"), "set_prefetch_margin", "get_prefetch_margin");
+
+    ClassDB::bind_method(D_METHOD("set_tile_cache_budget", "bytes"), &WorldGeneration::set_tile_cache_budget);
+    ClassDB::bind_method(D_METHOD("get_tile_cache_budget"), &WorldGeneration::get_tile_cache_budget);
+    ADD_PROPERTY(PropertyInfo(Variant::INT, "tile_cache_budget"), "set_tile_cache_budget", "get_tile_cache_budget");
+    ClassDB::bind_method(D_METHOD("get_tile_cache_memory_usage"), &WorldGeneration::get_tile_cache_memory_usage);
     
     // Expose constants
     ClassDB::bind_static_method("WorldGeneration", D_METHOD("get_region_size"), &WorldGeneration::get_region_size);
@@ -20,6 +42,7 @@ void WorldGeneration::_bind_methods() {
     
     ClassDB::bind_static_method("WorldGeneration", D_METHOD("pack_coords", "x", "y"), &WorldGeneration::pack_coords);
     ClassDB::bind_static_method("WorldGeneration", D_METHOD("unpack_coords", "key"), &WorldGeneration::unpack_coords);
+    ClassDB::bind_static_method("WorldGeneration", D_METHOD("get_region_at", "cellPos"), &WorldGeneration::get_region_at);
 
     BIND_CONSTANT(ROTATION_MASK);
     BIND_CONSTANT(ORIENTATION_SHIFT);
@@ -33,15 +56,34 @@ void WorldGeneration::_bind_methods() {
     // Method bindings
     ClassDB::bind_method(D_METHOD("update_world_bubble", "playerPos"), &WorldGeneration::update_world_bubble);
     ClassDB::bind_method(D_METHOD("init_region", "regionPos"), &WorldGeneration::init_region);
+    ClassDB::bind_method(D_METHOD("init_region_packed", "regionPos"), &WorldGeneration::init_region_packed);
+    ClassDB::bind_method(D_METHOD("init_region_async", "regionPos"), &WorldGeneration::init_region_async);
+    ClassDB::bind_method(D_METHOD("build_region_map_image", "regionPos", "sprites", "mipmaps"), &WorldGeneration::build_region_map_image, DEFVAL(true), DEFVAL(false));
+    ClassDB::bind_method(D_METHOD("_finish_region_task", "regionPos", "regionData"), &WorldGeneration::_finish_region_task);
+    ClassDB::bind_method(D_METHOD("get_biome_at", "cellPos"), &WorldGeneration::get_biome_at);
+    ClassDB::bind_method(D_METHOD("is_region_resident", "regionPos"), &WorldGeneration::is_region_resident);
+    ClassDB::bind_method(D_METHOD("get_resident_region_count"), &WorldGeneration::get_resident_region_count);
+    ClassDB::bind_method(D_METHOD("set_chunk_structure", "chunk_id", "structure_id"), &WorldGeneration::set_chunk_structure);
+    ClassDB::bind_method(D_METHOD("get_tiles_rect", "rect"), &WorldGeneration::get_tiles_rect);
+    ClassDB::bind_method(D_METHOD("get_region_memory_usage"), &WorldGeneration::get_region_memory_usage);
+    ClassDB::bind_method(D_METHOD("benchmark_chunk_lookup", "iterations"), &WorldGeneration::benchmark_chunk_lookup, DEFVAL(1000000));
+    ClassDB::bind_method(D_METHOD("benchmark_hash_kernel", "rows"), &WorldGeneration::benchmark_hash_kernel, DEFVAL(100000));
+    ClassDB::bind_method(D_METHOD("save_region", "regionPos", "path"), &WorldGeneration::save_region);
+    ClassDB::bind_method(D_METHOD("load_region", "path"), &WorldGeneration::load_region);
     ClassDB::bind_method(D_METHOD("drop_item", "pos", "item_id", "amount"), &WorldGeneration::drop_item);
     ClassDB::bind_method(D_METHOD("pickup_item", "pos", "inventory"), &WorldGeneration::pickup_item);
     ClassDB::bind_method(D_METHOD("has_item", "pos"), &WorldGeneration::has_item);
+
+    ADD_SIGNAL(MethodInfo("region_ready", PropertyInfo(Variant::VECTOR2I, "regionPos"), PropertyInfo(Variant::DICTIONARY, "regionData")));
 }
 
 WorldGeneration::WorldGeneration() {
 }
 
 WorldGeneration::~WorldGeneration() {
+    for (auto& pair : region_tasks) {
+        WorkerThreadPool::get_singleton()->wait_for_task_completion(pair.second);
+    }
 }
 
 // Property setters/getters
@@ -58,6 +100,7 @@ Ref<FastNoiseLite> WorldGeneration::get_biome_noise() const {
 
 void WorldGeneration::set_world_seed(int seed) {
     world_seed = seed;
+    generated_tiles.clear();
     if (biome_noise.is_valid()) {
         biome_noise->set_seed(seed);
     }
@@ -67,19 +110,6 @@ int WorldGeneration::get_world_seed() const {
     return world_seed;
 }
 
-uint16_t WorldGeneration::pick_weighted_tile(const BiomeInfo& info, uint32_t roll) {
-    if (info.ground_tiles.size() == 1) return info.ground_tiles[0].id;
-
-    int cumulative = 0;
-    for (const auto& tile : info.ground_tiles) {
-        cumulative += tile.weight;
-        if (roll < (uint32_t)cumulative) {
-            return tile.id;
-        }
-    }
-    return info.ground_tiles.empty() ? id_void : info.ground_tiles[0].id;
-}
-
 void WorldGeneration::setup_biome_rules() {
     if (!biome_rules.empty()) return; // Already setup
 
@@ -92,6 +122,9 @@ void WorldGeneration::setup_biome_rules() {
     id_forest = id_reg->register_string("forest");
     id_plains = id_reg->register_string("plains");
 
+    // Building chunks place the default house
+    chunk_structures[id_building] = id_reg->register_string("house01");
+
     // Helper to register a biome
     auto reg_biome = [&](const String& name, const std::vector<std::pair<String, int>>& tiles) {
         uint16_t b_id = id_reg->register_string(name);
@@ -99,6 +132,7 @@ void WorldGeneration::setup_biome_rules() {
         for (const auto& t : tiles) {
             info.ground_tiles.push_back({id_reg->register_string(t.first), t.second});
         }
+        info.compile_roll_table(id_void);
         biome_rules[b_id] = info;
     };
 
@@ -121,7 +155,8 @@ void WorldGeneration::setup_biome_rules() {
     auto reg_simple = [&](const String& name, const String& tile) {
         uint16_t b_id = id_reg->register_string(name);
         BiomeInfo info;
-        info.ground_tiles.push_back({id_reg->register_string(tile), 100});
+        info.ground_tiles.push_back({id_reg->register_string(tile), BiomeInfo::ROLL_RANGE});
+        info.compile_roll_table(id_void);
         biome_rules[b_id] = info;
     };
 
@@ -133,56 +168,160 @@ void WorldGeneration::setup_biome_rules() {
     reg_simple("wall", "w_wall");
 }
 
+// Generated tile of a cell, from the chunk cache. A miss regenerates the
+// whole chunk; cells of regions that are not resident read as void.
 uint16_t WorldGeneration::get_tile(int x, int y) {
-    int cx = (x >= 0) ? (x / CHUNK_SIZE) : ((x - (CHUNK_SIZE - 1)) / CHUNK_SIZE);
-    int cy = (y >= 0) ? (y / CHUNK_SIZE) : ((y - (CHUNK_SIZE - 1)) / CHUNK_SIZE);
-    uint64_t chunk_key = Occlusion::pack_coords(cx, cy);
-
-    if (!last_chunk_valid || last_chunk_key != chunk_key) {
-        auto it = region_chunks.find(chunk_key);
-        if (it == region_chunks.end()) {
-            last_chunk_valid = false;
+    const int cx = floor_div(x, CHUNK_SIZE);
+    const int cy = floor_div(y, CHUNK_SIZE);
+
+    const uint16_t* tiles = generated_tiles.find(cx, cy);
+    if (!tiles) {
+        RegionData* region = find_region(floor_div(cx, REGION_SIZE), floor_div(cy, REGION_SIZE));
+        if (!region) {
             return id_void;
         }
-        
-        uint32_t packed = it->second;
-        last_chunk_id = static_cast<uint16_t>(packed & ID_MASK);
-        last_chunk_rotation = static_cast<uint8_t>(packed >> ORIENTATION_SHIFT);
-        last_chunk_key = chunk_key;
-        
-        auto it_rule = biome_rules.find(last_chunk_id);
-        last_biome_ptr = (it_rule != biome_rules.end()) ? &it_rule->second : nullptr;
-        
-        last_chunk_valid = true;
+        if (!region->pending_edits.empty()) {
+            apply_saved_edits(*region, Occlusion::pack_coords(cx, cy));
+        }
+        uint16_t* out = generated_tiles.insert(cx, cy);
+        generate_chunk_tiles(Vector2i(cx, cy), out);
+        tiles = out;
+    }
+    return tiles[(y - cy * CHUNK_SIZE) * CHUNK_SIZE + (x - cx * CHUNK_SIZE)];
+}
+
+uint16_t WorldGeneration::get_cell_id(int x, int y) {
+    // Generate first: a chunk's saved edits are decoded when it is first generated
+    const uint16_t generated = get_tile(x, y);
+    const uint16_t tile_id = tile_id_cache.get(x, y);
+    return (tile_id != TileGrid::EMPTY) ? tile_id : generated;
+}
+
+// Pre-rotated tiles of the structure placed on a chunk, or nullptr
+const uint16_t* WorldGeneration::get_structure_tiles(uint16_t chunk_id, uint8_t rotation) const {
+    if (!s_db) return nullptr;
+    auto it = chunk_structures.find(chunk_id);
+    return s_db->get_rotated_tiles(it != chunk_structures.end() ? it->second : chunk_id, rotation);
+}
+
+void WorldGeneration::set_chunk_structure(const String& chunk_id, const String& structure_id) {
+    setup_biome_rules();
+    if (!id_reg) return;
+    chunk_structures[id_reg->register_string(chunk_id)] = id_reg->register_string(structure_id);
+    generated_tiles.clear();
+}
+
+// Fill a whole chunk (CHUNK_SIZE x CHUNK_SIZE, row-major) in one pass.
+// Produces the same tiles as get_tile; returns false and fills void if the
+// chunk's region is not resident.
+bool WorldGeneration::generate_chunk_tiles(const Vector2i& chunkPos, uint16_t* out) {
+    const int rx = floor_div(chunkPos.x, REGION_SIZE);
+    const int ry = floor_div(chunkPos.y, REGION_SIZE);
+    RegionData* region = find_region(rx, ry);
+    if (!region) {
+        std::fill(out, out + CHUNK_CELLS, id_void);
+        return false;
     }
+    region->last_used = ++region_use_tick;
 
-    const uint16_t chunk_id = last_chunk_id;
+    const int index = (chunkPos.y - ry * REGION_SIZE) * REGION_SIZE + (chunkPos.x - rx * REGION_SIZE);
+    const uint16_t chunk_id = region->chunk_ids[index];
+    const uint8_t rotation = region->chunk_rots[index];
 
-    // 1. Structure Lookup Path (Hot Path)
-    if (chunk_id == id_building && s_db) {
-        int lx = x % CHUNK_SIZE; if (lx < 0) lx += CHUNK_SIZE;
-        int ly = y % CHUNK_SIZE; if (ly < 0) ly += CHUNK_SIZE;
-        
-        int rx = lx, ry = ly;
-        int max_coord = CHUNK_SIZE - 1;
-        switch (last_chunk_rotation) {
-            case ROT_WEST: rx = ly; ry = max_coord - lx; break; // 1
-            case ROT_NORTH: rx = max_coord - lx; ry = max_coord - ly; break; // 2
-            case ROT_EAST: rx = max_coord - ly; ry = lx; break; // 3
+    auto it_rule = biome_rules.find(chunk_id);
+    const BiomeInfo* biome = (it_rule != biome_rules.end()) ? &it_rule->second : nullptr;
+
+    // 1. Biome ground, a row at a time: hash and roll, then one table load per cell
+    if (biome) {
+        const uint16_t* roll_table = biome->roll_table;
+        const uint32_t seed = static_cast<uint32_t>(world_seed);
+        uint32_t rolls[CHUNK_SIZE];
+        for (int ly = 0; ly < CHUNK_SIZE; ly++) {
+            CoordHash::hash_row(chunkPos.x * CHUNK_SIZE, chunkPos.y * CHUNK_SIZE + ly, seed, rolls, CHUNK_SIZE);
+            for (int lx = 0; lx < CHUNK_SIZE; lx++) {
+                rolls[lx] %= BiomeInfo::ROLL_RANGE;
+            }
+
+            uint16_t* row = out + ly * CHUNK_SIZE;
+            for (int lx = 0; lx < CHUNK_SIZE; lx++) {
+                row[lx] = roll_table[rolls[lx]];
+            }
+        }
+    } else {
+        std::fill(out, out + CHUNK_CELLS, id_void);
+    }
+
+    // 2. Structure tiles override the ground wherever they are not void
+    if (const uint16_t* structure = get_structure_tiles(chunk_id, rotation)) {
+        for (int i = 0; i < CHUNK_CELLS; i++) {
+            if (structure[i] != id_void) out[i] = structure[i];
         }
+    }
+
+    return true;
+}
+
+// Generated tile ids of a cell rectangle, row-major. Cells in regions that
+// are not resident read as void.
+PackedInt32Array WorldGeneration::get_tiles_rect(const Rect2i& rect) {
+    PackedInt32Array result;
+    if (rect.size.x <= 0 || rect.size.y <= 0) return result;
+
+    setup_biome_rules();
+    result.resize(static_cast<int64_t>(rect.size.x) * rect.size.y);
+    int32_t* dst = result.ptrw();
+
+    const Vector2i end = rect.position + rect.size;
+    const int cx0 = floor_div(rect.position.x, CHUNK_SIZE);
+    const int cy0 = floor_div(rect.position.y, CHUNK_SIZE);
+    const int cx1 = floor_div(end.x - 1, CHUNK_SIZE);
+    const int cy1 = floor_div(end.y - 1, CHUNK_SIZE);
+
+    uint16_t chunk[CHUNK_CELLS];
+    for (int cy = cy0; cy <= cy1; cy++) {
+        for (int cx = cx0; cx <= cx1; cx++) {
+            generate_chunk_tiles(Vector2i(cx, cy), chunk);
 
-        // Optimized StructureDb call
-        uint16_t tile_id = s_db->get_tile_at("house01", rx, ry);
-        if (tile_id != id_void) return tile_id;
+            const int x0 = std::max(rect.position.x, cx * CHUNK_SIZE);
+            const int x1 = std::min(end.x, (cx + 1) * CHUNK_SIZE);
+            const int y0 = std::max(rect.position.y, cy * CHUNK_SIZE);
+            const int y1 = std::min(end.y, (cy + 1) * CHUNK_SIZE);
+            for (int y = y0; y < y1; y++) {
+                const uint16_t* src = chunk + (y - cy * CHUNK_SIZE) * CHUNK_SIZE + (x0 - cx * CHUNK_SIZE);
+                int32_t* row = dst + static_cast<int64_t>(y - rect.position.y) * rect.size.x + (x0 - rect.position.x);
+                for (int x = 0; x < x1 - x0; x++) {
+                    row[x] = src[x];
+                }
+            }
+        }
+    }
+    return result;
+}
+
+// Render a single bubble cell: dropped items take precedence over the tile
+void WorldGeneration::render_cell(TileSlot& slot, int cx, int cy, RenderingServer* rs, RID texture_rid, TileDb* tile_db) {
+    // Player edits take precedence over generated tiles. Generate first: a
+    // chunk's saved edits are decoded when it is first generated.
+    uint16_t tile_id = get_tile(cx, cy);
+    const uint16_t edited_id = tile_id_cache.get(cx, cy);
+    if (edited_id != TileGrid::EMPTY) {
+        tile_id = edited_id;
     }
+    // Flags are refreshed on every render: region eviction drops their pages
+    set_cell_flags(cx, cy, tile_id);
 
-    // 2. Biome Logic Path (Using cached pointer)
-    if (last_biome_ptr) {
-        uint32_t h = get_hash(x, y, static_cast<uint32_t>(world_seed));
-        return pick_weighted_tile(*last_biome_ptr, h % 100);
+    // Items cover the tile but keep its flags
+    auto it_item = dropped_items.find(Occlusion::pack_coords(cx, cy));
+    if (it_item != dropped_items.end() && !it_item->second.empty()) {
+        ItemDb* item_db = ItemDb::get_singleton();
+        const ItemInfo* info = item_db ? item_db->get_item_info(it_item->second[0].id) : nullptr;
+        if (info) {
+            draw_atlas_rect(slot, cx, cy, info->atlas, rs, texture_rid);
+            return;
+        }
     }
 
-    return id_void;
+    update_tile_at(slot, cx, cy, tile_id, rs, texture_rid, tile_db);
 }
 
 // Update world bubble - main loop
@@ -192,106 +331,105 @@ void WorldGeneration::update_world_bubble(const Vector2i& playerPos) {
     }
     
     RenderingServer* rs = RenderingServer::get_singleton();
-    RID texture_rid = tilesheet->get_rid();
     TileDb* tile_db = TileDb::get_singleton();
     ItemDb* item_db = ItemDb::get_singleton();
     IdRegistry* id_reg = IdRegistry::get_singleton();
     if (!tile_db || !item_db || !id_reg) return;
     
-    // First pass: render tiles and build tile map
-    for (auto& pair : tile_rids) {
-        uint64_t offsetKey = pair.first;
-        
-        // Unpack offset
-        int ox = static_cast<int>(static_cast<int32_t>(offsetKey >> 32));
-        int oy = static_cast<int>(static_cast<int32_t>(offsetKey & 0xFFFFFFFF));
-        
+    // Keep the player's region resident and prefetch the ones ahead
+    update_streaming(playerPos, bubble_valid ? playerPos - bubble_center : Vector2i());
+
+    // First pass: scroll the ring buffer, rendering only newly exposed cells
+    scroll_world_bubble(playerPos);
+    
+    // Second pass: compute the whole visibility set in one shadowcasting sweep
+    fov.compute(playerPos, world_bubble_radius, [&](int x, int y) {
+        return opaque_cells.get(x, y);
+    });
+
+    // Third pass: apply modulation, only to slots whose fog state changed
+    for (TileSlot& slot : tile_slots) {
+        if (!slot.visible) continue;
+
         // Calculate cell position
-        int cx = ox + playerPos.x;
-        int cy = oy + playerPos.y;
-        uint64_t cellKey = Occlusion::pack_coords(cx, cy);
+        int cx = slot.cell.x;
+        int cy = slot.cell.y;
         
-        // Check for items first
-        auto it_item = dropped_items.find(cellKey);
-        if (it_item != dropped_items.end() && !it_item->second.empty()) {
-            uint16_t item_id_numeric = it_item->second[0].id;
-            const ItemInfo* info = item_db->get_item_info(item_id_numeric);
-            
-            if (info) {
-                Vector2i atlas_pos;
-                atlas_pos.x = 1 + info->atlas.x * (FastTileMap::get_tile_size() + 1);
-                atlas_pos.y = 1 + info->atlas.y * (FastTileMap::get_tile_size() + 1);
-
-                RID tile_rid = pair.second;
-                rs->canvas_item_clear(tile_rid);
-                rs->canvas_item_add_texture_rect_region(
-                    tile_rid,
-                    Rect2(ox * get_cell_size(), oy * get_cell_size(), FastTileMap::get_tile_size(), FastTileMap::get_tile_size()),
-                    texture_rid,
-                    Rect2(atlas_pos.x, atlas_pos.y, FastTileMap::get_tile_size(), FastTileMap::get_tile_size())
-                );
-                // Skip normal tile rendering
-                continue;
-            }
-        }
-        
-        // Get or compute tile ID
-        uint16_t tile_id;
-        auto it = tile_id_cache.find(cellKey);
-        if (it != tile_id_cache.end()) {
-            tile_id = it->second;
+        uint8_t state = FOG_VISIBLE;
+        if (!fov.is_visible(cx, cy)) {
+            state = seen_cells.get(cx, cy) ? FOG_SEEN : FOG_UNSEEN;
         } else {
-            tile_id = get_tile(cx, cy);
-            tile_id_cache[cellKey] = tile_id;
+            seen_cells.set(cx, cy, true);  // Mark as seen
         }
+
+        if (slot.fog_state == state) continue;
+        slot.fog_state = state;
         
-        update_tile_at(ox, oy, playerPos, tile_id, rs, texture_rid, tile_db);
+        switch (state) {
+            case FOG_SEEN: set_slot_modulate(slot, Color(0.4f, 0.4f, 0.5f, 1.0f), rs); break;  // Previously seen
+            case FOG_UNSEEN: set_slot_modulate(slot, Color(0.0f, 0.0f, 0.0f, 1.0f), rs); break;  // Never seen
+            default: set_slot_modulate(slot, Color(1.0f, 1.0f, 1.0f, 1.0f), rs); break;
+        }
     }
-    
-    // Second pass: compute occlusion and apply modulation
-    for (auto& pair : tile_rids) {
-        uint64_t offsetKey = pair.first;
-        RID tile_rid = pair.second;
-        
-        // Unpack offset
-        int ox = static_cast<int>(static_cast<int32_t>(offsetKey >> 32));
-        int oy = static_cast<int>(static_cast<int32_t>(offsetKey & 0xFFFFFFFF));
-        
-        // Calculate cell position
-        int cx = ox + playerPos.x;
-        int cy = oy + playerPos.y;
-        uint64_t cellKey = Occlusion::pack_coords(cx, cy);
-        
-        bool occluded;
-        Vector2i cellPos(cx, cy);
-        occluded = Occlusion::is_occluded(cellPos, playerPos, tile_id_cache);
-        
-        Color color(1.0f, 1.0f, 1.0f, 1.0f);
-        if (occluded) {
-            if (seen_cells.count(cellKey) > 0) {
-                color = Color(0.4f, 0.4f, 0.5f, 1.0f);  // Previously seen
-            } else {
-                color = Color(0.0f, 0.0f, 0.0f, 1.0f);  // Never seen
+
+    flush_batches(rs, tilesheet->get_rid());
+}
+
+// Private copy of the biome noise for one region generation. Taken on the
+// main thread, so workers never touch (or emit changed on) the shared resource.
+Ref<FastNoiseLite> WorldGeneration::snapshot_biome_noise() const {
+    if (biome_noise.is_null()) return Ref<FastNoiseLite>();
+    return biome_noise->duplicate();
+}
+
+// Biome of every chunk in the region as a byte grid. The biome noise is
+// sampled for the whole region in one get_image call (one L8 pixel per chunk,
+// offset to the region's chunk coords); without noise, a hash coin flip.
+// noise must be a snapshot owned by this generation: its offset is moved.
+void WorldGeneration::generate_biome_map(const Vector2i& regionPos, uint32_t seed, const Ref<FastNoiseLite>& noise, RegionData& r_region) const {
+    r_region.biomes.resize(REGION_SIZE * REGION_SIZE);
+    uint8_t* biomes = r_region.biomes.data();
+
+    if (noise.is_valid()) {
+        const Vector3 offset = noise->get_offset();
+        noise->set_offset(Vector3(offset.x + regionPos.x * REGION_SIZE, offset.y + regionPos.y * REGION_SIZE, offset.z));
+        Ref<Image> image = noise->get_image(REGION_SIZE, REGION_SIZE, false, false, false);
+
+        if (image.is_valid() && image->get_format() == Image::FORMAT_L8) {
+            const PackedByteArray data = image->get_data();
+            if (data.size() == REGION_SIZE * REGION_SIZE) {
+                const uint8_t* values = data.ptr();
+                for (int i = 0; i < REGION_SIZE * REGION_SIZE; i++) {
+                    biomes[i] = (values[i] >= 128) ? BIOME_FOREST : BIOME_PLAINS;
+                }
+                return;
             }
-        } else {
-            seen_cells.insert(cellKey);  // Mark as seen
         }
-        
-        rs->canvas_item_set_modulate(tile_rid, color);
+    }
+
+    uint32_t row_hashes[REGION_SIZE];
+    for (int y = 0; y < REGION_SIZE; y++) {
+        CoordHash::hash_row(regionPos.x * REGION_SIZE, regionPos.y * REGION_SIZE + y, seed, row_hashes, REGION_SIZE);
+        for (int x = 0; x < REGION_SIZE; x++) {
+            biomes[y * REGION_SIZE + x] = (row_hashes[x] % 100 < 50) ? BIOME_FOREST : BIOME_PLAINS;
+        }
     }
 }
 
-// Initialize world bubble
-Dictionary WorldGeneration::init_region(const Vector2i& regionPos) {
-    setup_biome_rules();
-    
-    region_chunks.clear();
-    last_chunk_valid = false;
+// Region generation touches no scene state, so it can run on a worker thread
+void WorldGeneration::generate_region(const Vector2i& regionPos, uint32_t seed, const Ref<FastNoiseLite>& noise, RegionData& r_region) const {
+    r_region.coord = regionPos;
+    generate_biome_map(regionPos, seed, noise, r_region);
+
+    // Every region gets its own settlement seed; the cities and outposts are
+    // placed and generated by CityGeneration
+    const uint32_t region_seed = get_hash(regionPos.x, regionPos.y, seed);
 
     Canvas cityCanvas(REGION_SIZE);
-    CityGeneration::spawn_city(cityCanvas, 127, 128, world_seed);
+    CityGeneration::spawn_settlements(cityCanvas, region_seed);
 
-    Dictionary result;
+    r_region.chunk_ids.resize(REGION_SIZE * REGION_SIZE);
+    r_region.chunk_rots.resize(REGION_SIZE * REGION_SIZE);
     for (int y = 0; y < REGION_SIZE; y++) {
         for (int x = 0; x < REGION_SIZE; x++) {
             CityPixel pixel = cityCanvas.getPixel(x, y);
@@ -299,28 +437,696 @@ Dictionary WorldGeneration::init_region(const Vector2i& regionPos) {
             
             // Fallback to biome
             if (chunk_id == id_void) {
-                int gx = regionPos.x * REGION_SIZE + x;
-                int gy = regionPos.y * REGION_SIZE + y;
-                uint32_t h = get_hash(gx, gy, static_cast<uint32_t>(world_seed));
-                chunk_id = (h % 100 < 50) ? id_forest : id_plains;
+                chunk_id = (r_region.biomes[y * REGION_SIZE + x] == BIOME_FOREST) ? id_forest : id_plains;
+            }
+
+            r_region.chunk_ids[y * REGION_SIZE + x] = chunk_id;
+            r_region.chunk_rots[y * REGION_SIZE + x] = pixel.meta & ROTATION_MASK;
+        }
+    }
+}
+
+Dictionary WorldGeneration::build_region_dictionary(const RegionData& p_region) const {
+    Dictionary result;
+    for (int y = 0; y < REGION_SIZE; y++) {
+        for (int x = 0; x < REGION_SIZE; x++) {
+            uint64_t key = Occlusion::pack_coords(p_region.coord.x * REGION_SIZE + x, p_region.coord.y * REGION_SIZE + y);
+            result[key] = id_reg->get_string(p_region.chunk_ids[y * REGION_SIZE + x]);
+        }
+    }
+    return result;
+}
+
+// Region chunks as a compact binary block. "chunks" holds two bytes per
+// chunk, row-major: palette index and rotation (the layout of
+// Image::FORMAT_RG8). "palette" maps palette indices to chunk names.
+Dictionary WorldGeneration::build_region_packed(const RegionData& p_region) const {
+    PackedByteArray chunks;
+    chunks.resize(REGION_SIZE * REGION_SIZE * 2);
+    uint8_t* out = chunks.ptrw();
+
+    PackedStringArray palette;
+    std::unordered_map<uint16_t, uint8_t> palette_index;
+    uint16_t last_id = 0;
+    uint8_t last_index = 0;
+    bool has_last = false;
+
+    const uint16_t* ids = p_region.chunk_ids.data();
+    const uint8_t* rots = p_region.chunk_rots.data();
+    for (int i = 0; i < REGION_SIZE * REGION_SIZE; i++) {
+        const uint16_t id = ids[i];
+        if (!has_last || id != last_id) {
+            auto it = palette_index.find(id);
+            if (it == palette_index.end()) {
+                ERR_FAIL_COND_V_MSG(palette.size() > 255, Dictionary(), "Region has more than 256 chunk types.");
+                it = palette_index.emplace(id, static_cast<uint8_t>(palette.size())).first;
+                palette.push_back(id_reg->get_string(id));
             }
+            last_id = id;
+            last_index = it->second;
+            has_last = true;
+        }
+        out[i * 2] = last_index;
+        out[i * 2 + 1] = rots[i];
+    }
 
-            uint8_t rot = pixel.meta & ROTATION_MASK;
+    Dictionary result;
+    result["position"] = p_region.coord;
+    result["size"] = REGION_SIZE;
+    result["chunks"] = chunks;
+    result["palette"] = palette;
+    return result;
+}
 
-            // Store the chunk type using packed coordinates relative to regionPos
-            int gx = regionPos.x * REGION_SIZE + x;
-            int gy = regionPos.y * REGION_SIZE + y;
-            uint64_t key = Occlusion::pack_coords(gx, gy);
+int64_t WorldGeneration::get_region_memory_usage() const {
+    int64_t total = 0;
+    for (const auto& pair : regions) {
+        total += static_cast<int64_t>(pair.second->get_memory_usage());
+    }
+    return total;
+}
+
+// Micro-benchmark: random chunk lookups across the resident regions.
+// Reports resident chunk memory and the average lookup latency.
+Dictionary WorldGeneration::benchmark_chunk_lookup(int p_iterations) {
+    Dictionary result;
+    result["regions"] = static_cast<int>(regions.size());
+    result["memory_bytes"] = get_region_memory_usage();
+    if (regions.empty() || p_iterations <= 0) return result;
+
+    std::vector<const RegionData*> resident;
+    for (const auto& pair : regions) {
+        resident.push_back(pair.second.get());
+    }
+
+    std::mt19937 rng(static_cast<uint32_t>(world_seed));
+    std::vector<Vector2i> samples(p_iterations);
+    for (Vector2i& sample : samples) {
+        const RegionData* region = resident[rng() % resident.size()];
+        sample = Vector2i(
+            region->coord.x * REGION_SIZE + static_cast<int>(rng() % REGION_SIZE),
+            region->coord.y * REGION_SIZE + static_cast<int>(rng() % REGION_SIZE)
+        );
+    }
 
-            // Pack rotation (8-bit) and chunk_id (16-bit) into 32-bit map value
-            region_chunks[key] = (static_cast<uint32_t>(rot) << ORIENTATION_SHIFT) | chunk_id;
-            result[key] = id_reg->get_string(chunk_id);
+    uint32_t checksum = 0;
+    const uint64_t start = Time::get_singleton()->get_ticks_usec();
+    for (const Vector2i& sample : samples) {
+        const int rx = floor_div(sample.x, REGION_SIZE);
+        const int ry = floor_div(sample.y, REGION_SIZE);
+        const RegionData* region = find_region(rx, ry);
+        if (region) {
+            checksum += region->chunk_ids[(sample.y - ry * REGION_SIZE) * REGION_SIZE + (sample.x - rx * REGION_SIZE)];
         }
     }
+    const uint64_t elapsed = Time::get_singleton()->get_ticks_usec() - start;
+
+    result["iterations"] = p_iterations;
+    result["ns_per_lookup"] = static_cast<double>(elapsed) * 1000.0 / p_iterations;
+    result["checksum"] = static_cast<int64_t>(checksum);
+    return result;
+}
+
+// Micro-benchmark: the row hash kernel on every path this CPU supports.
+// Reports ns per hash for each path and whether it matched the scalar path.
+Dictionary WorldGeneration::benchmark_hash_kernel(int p_rows) {
+    Dictionary result;
+    result["best"] = CoordHash::get_path_name(CoordHash::get_best_path());
+    if (p_rows <= 0) return result;
+
+    std::vector<uint32_t> expected(REGION_SIZE);
+    std::vector<uint32_t> hashes(REGION_SIZE);
+    const uint32_t seed = static_cast<uint32_t>(world_seed);
 
+    const CoordHash::Path paths[] = { CoordHash::PATH_SCALAR, CoordHash::PATH_SSE2, CoordHash::PATH_AVX2 };
+    for (CoordHash::Path path : paths) {
+        if (!CoordHash::is_supported(path)) continue;
+
+        bool identical = true;
+        uint32_t checksum = 0;
+        const uint64_t start = Time::get_singleton()->get_ticks_usec();
+        for (int row = 0; row < p_rows; row++) {
+            CoordHash::hash_row(path, -REGION_SIZE / 2, row, seed, hashes.data(), REGION_SIZE);
+            checksum += hashes[row % REGION_SIZE];
+        }
+        const uint64_t elapsed = Time::get_singleton()->get_ticks_usec() - start;
+
+        for (int row = 0; row < p_rows && identical; row += 97) {
+            CoordHash::hash_row(CoordHash::PATH_SCALAR, -REGION_SIZE / 2, row, seed, expected.data(), REGION_SIZE);
+            CoordHash::hash_row(path, -REGION_SIZE / 2, row, seed, hashes.data(), REGION_SIZE);
+            identical = expected == hashes;
+        }
+
+        Dictionary entry;
+        entry["ns_per_hash"] = static_cast<double>(elapsed) * 1000.0 / (static_cast<double>(p_rows) * REGION_SIZE);
+        entry["identical"] = identical;
+        entry["checksum"] = static_cast<int64_t>(checksum);
+        result[CoordHash::get_path_name(path)] = entry;
+    }
     return result;
 }
 
+RegionData* WorldGeneration::find_region(int rx, int ry) const {
+    auto it = regions.find(Occlusion::pack_coords(rx, ry));
+    return (it != regions.end()) ? it->second.get() : nullptr;
+}
+
+// Underlying biome of a cell, read from its region's biome map
+String WorldGeneration::get_biome_at(const Vector2i& cellPos) const {
+    const int cx = floor_div(cellPos.x, CHUNK_SIZE);
+    const int cy = floor_div(cellPos.y, CHUNK_SIZE);
+    const int rx = floor_div(cx, REGION_SIZE);
+    const int ry = floor_div(cy, REGION_SIZE);
+    const RegionData* region = find_region(rx, ry);
+    if (!region) return "void";
+    return region->biomes[(cy - ry * REGION_SIZE) * REGION_SIZE + (cx - rx * REGION_SIZE)] == BIOME_FOREST ? "forest" : "plains";
+}
+
+// Resident region, generating and publishing it on this thread if needed
+RegionData* WorldGeneration::ensure_region(const Vector2i& regionPos) {
+    setup_biome_rules();
+
+    RegionData* region = find_region(regionPos.x, regionPos.y);
+    if (region) return region;
+
+    std::unique_ptr<RegionData> generated = std::make_unique<RegionData>();
+    generate_region(regionPos, static_cast<uint32_t>(world_seed), snapshot_biome_noise(), *generated);
+    publish_region(std::move(generated));
+    return find_region(regionPos.x, regionPos.y);
+}
+
+void WorldGeneration::publish_region(std::unique_ptr<RegionData> p_region) {
+    const Vector2i coord = p_region->coord;
+    p_region->last_used = ++region_use_tick;
+    regions[Occlusion::pack_coords(coord.x, coord.y)] = std::move(p_region);
+
+    // Cells the bubble rendered before the region existed came out as void
+    if (bubble_valid) {
+        const int chunk_span = REGION_SIZE * CHUNK_SIZE;
+        const Rect2i region_rect(coord * chunk_span, Vector2i(chunk_span, chunk_span));
+        const Rect2i bubble_rect(bubble_center - Vector2i(world_bubble_radius, world_bubble_radius), Vector2i(world_bubble_size, world_bubble_size));
+        if (region_rect.intersects(bubble_rect)) {
+            invalidate_world_bubble();
+        }
+    }
+
+    evict_regions(bubble_valid ? get_region_at(bubble_center) : coord);
+}
+
+void WorldGeneration::evict_regions(const Vector2i& keep) {
+    while (static_cast<int>(regions.size()) > max_resident_regions) {
+        auto lru = regions.end();
+        for (auto it = regions.begin(); it != regions.end(); ++it) {
+            if (it->second->coord == keep) continue;
+            if (lru == regions.end() || it->second->last_used < lru->second->last_used) {
+                lru = it;
+            }
+        }
+        if (lru == regions.end()) break;
+
+        flush_saved_edits(*lru->second);
+
+        // Drop the region's cell flags; cells rendered again re-derive them.
+        // Cells still shown in the bubble keep theirs until they scroll out.
+        const int span = REGION_SIZE * CHUNK_SIZE;
+        const int x0 = lru->second->coord.x * span, y0 = lru->second->coord.y * span;
+        const int bx0 = bubble_center.x - world_bubble_radius, by0 = bubble_center.y - world_bubble_radius;
+        const bool in_bubble = bubble_valid && x0 < bx0 + world_bubble_size && bx0 < x0 + span &&
+                               y0 < by0 + world_bubble_size && by0 < y0 + span;
+        if (!in_bubble) {
+            opaque_cells.erase_pages(x0, y0, x0 + span, y0 + span);
+            walkable_cells.erase_pages(x0, y0, x0 + span, y0 + span);
+        }
+        regions.erase(lru);
+    }
+}
+
+void WorldGeneration::request_region(const Vector2i& regionPos) {
+    uint64_t key = Occlusion::pack_coords(regionPos.x, regionPos.y);
+    if (regions.count(key) || region_tasks.count(key)) return;
+
+    // Registry writes happen here, on the main thread
+    setup_biome_rules();
+
+    region_tasks[key] = WorkerThreadPool::get_singleton()->add_task(
+        callable_mp(this, &WorldGeneration::_region_task).bind(regionPos, world_seed, snapshot_biome_noise()),
+        false,
+        "Region generation"
+    );
+}
+
+void WorldGeneration::update_streaming(const Vector2i& playerPos, const Vector2i& heading) {
+    const Vector2i region = get_region_at(playerPos);
+    request_region(region);
+
+    // Prefetch the neighbours the player is near and not walking away from
+    const int local_x = floor_div(playerPos.x, CHUNK_SIZE) - region.x * REGION_SIZE;
+    const int local_y = floor_div(playerPos.y, CHUNK_SIZE) - region.y * REGION_SIZE;
+
+    int dir_x = 0, dir_y = 0;
+    if (local_x < prefetch_margin && heading.x <= 0) dir_x = -1;
+    else if (local_x >= REGION_SIZE - prefetch_margin && heading.x >= 0) dir_x = 1;
+    if (local_y < prefetch_margin && heading.y <= 0) dir_y = -1;
+    else if (local_y >= REGION_SIZE - prefetch_margin && heading.y >= 0) dir_y = 1;
+
+    if (dir_x != 0) request_region(Vector2i(region.x + dir_x, region.y));
+    if (dir_y != 0) request_region(Vector2i(region.x, region.y + dir_y));
+    if (dir_x != 0 && dir_y != 0) request_region(Vector2i(region.x + dir_x, region.y + dir_y));
+
+    if (RegionData* current = find_region(region.x, region.y)) {
+        current->last_used = ++region_use_tick;
+    }
+}
+
+// Initialize world region (blocking)
+Dictionary WorldGeneration::init_region(const Vector2i& regionPos) {
+    setup_biome_rules();
+    
+    std::unique_ptr<RegionData> region = std::make_unique<RegionData>();
+    generate_region(regionPos, static_cast<uint32_t>(world_seed), snapshot_biome_noise(), *region);
+
+    Dictionary result = build_region_dictionary(*region);
+    publish_region(std::move(region));
+    return result;
+}
+
+// Initialize world region (blocking), returning the packed format of build_region_packed
+Dictionary WorldGeneration::init_region_packed(const Vector2i& regionPos) {
+    RegionData* region = ensure_region(regionPos);
+    return region ? build_region_packed(*region) : Dictionary();
+}
+
+// Overview image of a region for the map screen. With p_sprites each chunk is
+// drawn as its ChunkDb atlas sprite (TILE_SIZE pixels per chunk), otherwise
+// as one pixel of the sprite's average colour.
+Ref<Image> WorldGeneration::build_region_map_image(const Vector2i& regionPos, bool p_sprites, bool p_mipmaps) {
+    ChunkDb* chunk_db = ChunkDb::get_singleton();
+    ERR_FAIL_COND_V_MSG(!tilesheet.is_valid() || !chunk_db, Ref<Image>(), "Tilesheet and ChunkDb are required to build the region map.");
+
+    RegionData* region = ensure_region(regionPos);
+    if (!region) return Ref<Image>();
+
+    Ref<Image> sheet = tilesheet->get_image();
+    ERR_FAIL_COND_V(sheet.is_null(), Ref<Image>());
+    if (sheet->is_compressed()) {
+        sheet->decompress();
+    }
+    if (sheet->get_format() != Image::FORMAT_RGBA8) {
+        sheet->convert(Image::FORMAT_RGBA8);
+    }
+    const int sheet_width = sheet->get_width();
+    const int sheet_height = sheet->get_height();
+    const PackedByteArray sheet_data = sheet->get_data();
+    const uint8_t* sheet_pixels = sheet_data.ptr();
+
+    // RGBA sprite (and average colour) of every chunk type in the region, resolved once
+    constexpr int SPRITE_BYTES = TILE_SIZE * TILE_SIZE * 4;
+    std::unordered_map<uint16_t, std::vector<uint8_t>> sprites;
+    auto get_sprite = [&](uint16_t chunk_id) -> const uint8_t* {
+        auto it = sprites.find(chunk_id);
+        if (it != sprites.end()) return it->second.data();
+
+        std::vector<uint8_t> sprite(SPRITE_BYTES + 4, 0);
+        const ChunkInfo* info = chunk_db->get_chunk_info(id_reg->get_string(chunk_id));
+        if (info) {
+            const int sx = 1 + info->atlas.x * (TILE_SIZE + 1);
+            const int sy = 1 + info->atlas.y * (TILE_SIZE + 1);
+            if (info->atlas.x >= 0 && info->atlas.y >= 0 && sx + TILE_SIZE <= sheet_width && sy + TILE_SIZE <= sheet_height) {
+                uint32_t sum[4] = { 0, 0, 0, 0 };
+                for (int y = 0; y < TILE_SIZE; y++) {
+                    const uint8_t* src = sheet_pixels + (static_cast<int64_t>(sy + y) * sheet_width + sx) * 4;
+                    std::copy(src, src + TILE_SIZE * 4, sprite.begin() + y * TILE_SIZE * 4);
+                    for (int i = 0; i < TILE_SIZE * 4; i++) {
+                        sum[i & 3] += src[i];
+                    }
+                }
+                for (int c = 0; c < 4; c++) {
+                    sprite[SPRITE_BYTES + c] = static_cast<uint8_t>(sum[c] / (TILE_SIZE * TILE_SIZE));
+                }
+            }
+        }
+        return sprites.emplace(chunk_id, std::move(sprite)).first->second.data();
+    };
+
+    const int scale = p_sprites ? TILE_SIZE : 1;
+    const int size = REGION_SIZE * scale;
+    PackedByteArray data;
+    data.resize(static_cast<int64_t>(size) * size * 4);
+    uint8_t* out = data.ptrw();
+
+    for (int cy = 0; cy < REGION_SIZE; cy++) {
+        uint16_t last_id = 0;
+        const uint8_t* sprite = nullptr;
+        for (int cx = 0; cx < REGION_SIZE; cx++) {
+            const uint16_t chunk_id = region->chunk_ids[cy * REGION_SIZE + cx];
+            if (!sprite || chunk_id != last_id) {
+                sprite = get_sprite(chunk_id);
+                last_id = chunk_id;
+            }
+
+            if (p_sprites) {
+                for (int y = 0; y < TILE_SIZE; y++) {
+                    uint8_t* dst = out + ((static_cast<int64_t>(cy) * TILE_SIZE + y) * size + cx * TILE_SIZE) * 4;
+                    std::copy(sprite + y * TILE_SIZE * 4, sprite + (y + 1) * TILE_SIZE * 4, dst);
+                }
+            } else {
+                std::copy(sprite + SPRITE_BYTES, sprite + SPRITE_BYTES + 4, out + (static_cast<int64_t>(cy) * size + cx) * 4);
+            }
+        }
+    }
+
+    Ref<Image> image = Image::create_from_data(size, size, false, Image::FORMAT_RGBA8, data);
+    if (p_mipmaps && image.is_valid()) {
+        image->generate_mipmaps();
+    }
+    return image;
+}
+
+// Initialize world region on the WorkerThreadPool; emits region_ready with
+// the packed region when published
+void WorldGeneration::init_region_async(const Vector2i& regionPos) {
+    if (RegionData* region = find_region(regionPos.x, regionPos.y)) {
+        call_deferred("emit_signal", "region_ready", regionPos, build_region_packed(*region));
+        return;
+    }
+    request_region(regionPos);
+}
+
+void WorldGeneration::_region_task(const Vector2i& regionPos, int seed, const Ref<FastNoiseLite>& noise) {
+    std::unique_ptr<RegionData> region = std::make_unique<RegionData>();
+    generate_region(regionPos, static_cast<uint32_t>(seed), noise, *region);
+    Dictionary result = build_region_packed(*region);
+
+    {
+        std::lock_guard<std::mutex> lock(region_mutex);
+        finished_regions[Occlusion::pack_coords(regionPos.x, regionPos.y)] = std::move(region);
+    }
+
+    call_deferred("_finish_region_task", regionPos, result);
+}
+
+void WorldGeneration::_finish_region_task(const Vector2i& regionPos, const Dictionary& regionData) {
+    uint64_t key = Occlusion::pack_coords(regionPos.x, regionPos.y);
+
+    auto it_task = region_tasks.find(key);
+    if (it_task != region_tasks.end()) {
+        WorkerThreadPool::get_singleton()->wait_for_task_completion(it_task->second);
+        region_tasks.erase(it_task);
+    }
+
+    std::unique_ptr<RegionData> region;
+    {
+        std::lock_guard<std::mutex> lock(region_mutex);
+        auto it = finished_regions.find(key);
+        if (it == finished_regions.end()) return;
+        region = std::move(it->second);
+        finished_regions.erase(it);
+    }
+
+    // Publish the finished region on the main thread, unless one was loaded meanwhile
+    if (!find_region(regionPos.x, regionPos.y)) {
+        publish_region(std::move(region));
+    }
+
+    emit_signal("region_ready", regionPos, regionData);
+}
+
+// Decode one chunk's saved edit overlay into tile_id_cache
+void WorldGeneration::apply_saved_edits(RegionData& r_region, uint64_t chunk_key) {
+    auto it = r_region.pending_edits.find(chunk_key);
+    if (it == r_region.pending_edits.end()) return;
+
+    const Vector2i chunk = unpack_coords(chunk_key);
+    const uint8_t* blob = r_region.saved_edits.data() + it->second;
+    for (int i = 0; i < CHUNK_CELLS; i++) {
+        uint16_t local;
+        std::memcpy(&local, blob + i * sizeof(uint16_t), sizeof(local));
+        if (local == TileGrid::EMPTY) continue;
+
+        const uint16_t tile_id = (local < r_region.saved_id_map.size()) ? r_region.saved_id_map[local] : id_void;
+        set_cell_id(chunk.x * CHUNK_SIZE + i % CHUNK_SIZE, chunk.y * CHUNK_SIZE + i / CHUNK_SIZE, tile_id);
+    }
+
+    r_region.pending_edits.erase(it);
+    if (r_region.pending_edits.empty()) {
+        r_region.saved_edits = std::vector<uint8_t>();
+        r_region.saved_id_map = std::vector<uint16_t>();
+    }
+}
+
+void WorldGeneration::flush_saved_edits(RegionData& r_region) {
+    while (!r_region.pending_edits.empty()) {
+        apply_saved_edits(r_region, r_region.pending_edits.begin()->first);
+    }
+}
+
+// Write a resident region to a versioned binary file (see RegionFile): the
+// chunk grid, per-chunk edit overlays, seen pages and dropped items inside
+// the region. Ids are stored as indices into a name palette, so the file
+// does not depend on IdRegistry order.
+Error WorldGeneration::save_region(const Vector2i& regionPos, const String& path) {
+    RegionData* region = find_region(regionPos.x, regionPos.y);
+    ERR_FAIL_COND_V_MSG(!region || !id_reg, ERR_UNAVAILABLE, "Region is not resident.");
+    flush_saved_edits(*region);
+
+    std::vector<uint16_t> palette;
+    std::unordered_map<uint16_t, uint16_t> local_ids;
+    auto to_local = [&](uint16_t id) -> uint16_t {
+        auto it = local_ids.find(id);
+        if (it != local_ids.end()) return it->second;
+        const uint16_t local = static_cast<uint16_t>(palette.size());
+        local_ids.emplace(id, local);
+        palette.push_back(id);
+        return local;
+    };
+
+    const int span = REGION_SIZE * CHUNK_SIZE; // Cells per region side
+    const int x0 = regionPos.x * span;
+    const int y0 = regionPos.y * span;
+    auto in_region = [&](int x, int y) {
+        return x >= x0 && x < x0 + span && y >= y0 && y < y0 + span;
+    };
+
+    RegionFile::Writer writer;
+
+    // Chunk grid: ids, then rotations, then biomes
+    const int count = REGION_SIZE * REGION_SIZE;
+    std::vector<uint16_t> chunk_ids(count);
+    for (int i = 0; i < count; i++) {
+        chunk_ids[i] = to_local(region->chunk_ids[i]);
+    }
+    writer.begin_section(RegionFile::SECTION_CHUNKS);
+    writer.write_bytes(chunk_ids.data(), count * sizeof(uint16_t));
+    writer.write_bytes(region->chunk_rots.data(), count);
+    writer.write_bytes(region->biomes.data(), count);
+    writer.end_section();
+
+    // Edit overlays: a { cx, cy, offset } table, then one CHUNK_CELLS blob per edited chunk
+    std::map<uint64_t, std::vector<uint16_t>> edited_chunks;
+    tile_id_cache.for_each([&](int x, int y, uint16_t tile_id) {
+        if (!in_region(x, y)) return;
+        const int cx = floor_div(x, CHUNK_SIZE);
+        const int cy = floor_div(y, CHUNK_SIZE);
+        std::vector<uint16_t>& tiles = edited_chunks[Occlusion::pack_coords(cx, cy)];
+        if (tiles.empty()) tiles.assign(CHUNK_CELLS, TileGrid::EMPTY);
+        tiles[(y - cy * CHUNK_SIZE) * CHUNK_SIZE + (x - cx * CHUNK_SIZE)] = to_local(tile_id);
+    });
+    writer.begin_section(RegionFile::SECTION_EDITS);
+    writer.write<uint32_t>(static_cast<uint32_t>(edited_chunks.size()));
+    uint32_t blob_offset = static_cast<uint32_t>(sizeof(uint32_t) + edited_chunks.size() * 3 * sizeof(uint32_t));
+    for (const auto& pair : edited_chunks) {
+        const Vector2i chunk = unpack_coords(pair.first);
+        writer.write<int32_t>(chunk.x);
+        writer.write<int32_t>(chunk.y);
+        writer.write<uint32_t>(blob_offset);
+        blob_offset += CHUNK_CELLS * sizeof(uint16_t);
+    }
+    for (const auto& pair : edited_chunks) {
+        writer.write_bytes(pair.second.data(), CHUNK_CELLS * sizeof(uint16_t));
+    }
+    writer.end_section();
+
+    // Seen cells: whole BitGrid pages (region spans are page aligned)
+    writer.begin_section(RegionFile::SECTION_SEEN);
+    writer.write<uint32_t>(0);
+    uint32_t page_count = 0;
+    seen_cells.for_each_page([&](int px, int py, const BitGrid::Page& page) {
+        if (!in_region(px * BitGrid::PAGE_SIZE, py * BitGrid::PAGE_SIZE)) return;
+        writer.write<int32_t>(px);
+        writer.write<int32_t>(py);
+        writer.write_bytes(page.rows, sizeof(page.rows));
+        page_count++;
+    });
+    writer.patch(0, &page_count, sizeof(page_count));
+    writer.end_section();
+
+    // Dropped items: { x, y, id, amount } per stack
+    writer.begin_section(RegionFile::SECTION_ITEMS);
+    writer.write<uint32_t>(0);
+    uint32_t stack_count = 0;
+    for (const auto& pair : dropped_items) {
+        const Vector2i pos = unpack_coords(pair.first);
+        if (!in_region(pos.x, pos.y)) continue;
+        for (const DroppedItem& item : pair.second) {
+            writer.write<int32_t>(pos.x);
+            writer.write<int32_t>(pos.y);
+            writer.write<uint16_t>(to_local(item.id));
+            writer.write<int32_t>(item.amount);
+            stack_count++;
+        }
+    }
+    writer.patch(0, &stack_count, sizeof(stack_count));
+    writer.end_section();
+
+    // Palette last, once every id has been seen
+    writer.begin_section(RegionFile::SECTION_PALETTE);
+    writer.write<uint32_t>(static_cast<uint32_t>(palette.size()));
+    for (uint16_t id : palette) {
+        auto utf8 = id_reg->get_string(id).utf8();
+        const char* name = utf8.get_data();
+        const uint16_t length = static_cast<uint16_t>(std::strlen(name));
+        writer.write<uint16_t>(length);
+        writer.write_bytes(name, length);
+    }
+    writer.end_section();
+
+    const std::vector<uint8_t> bytes = writer.finish(regionPos.x, regionPos.y);
+    PackedByteArray buffer;
+    buffer.resize(static_cast<int64_t>(bytes.size()));
+    std::memcpy(buffer.ptrw(), bytes.data(), bytes.size());
+
+    Ref<FileAccess> file = FileAccess::open(path, FileAccess::WRITE);
+    ERR_FAIL_COND_V_MSG(file.is_null(), FileAccess::get_open_error(), "Cannot open region file for writing.");
+    file->store_buffer(buffer);
+    const Error error = file->get_error();
+    ERR_FAIL_COND_V_MSG(error != OK, error, "Failed to write region file.");
+    return OK;
+}
+
+// Load a region file written by save_region with a single buffer read. The
+// region is published as resident without regenerating it; edit overlays
+// stay encoded until their chunk is first generated.
+Error WorldGeneration::load_region(const String& path) {
+    setup_biome_rules();
+    ERR_FAIL_COND_V(!id_reg, ERR_UNAVAILABLE);
+
+    Ref<FileAccess> file = FileAccess::open(path, FileAccess::READ);
+    ERR_FAIL_COND_V_MSG(file.is_null(), FileAccess::get_open_error(), "Cannot open region file.");
+    const PackedByteArray buffer = file->get_buffer(static_cast<int64_t>(file->get_length()));
+    const uint8_t* data = buffer.ptr();
+
+    int32_t rx = 0, ry = 0;
+    std::vector<RegionFile::Section> sections;
+    ERR_FAIL_COND_V_MSG(!RegionFile::parse(data, static_cast<size_t>(buffer.size()), rx, ry, sections), ERR_FILE_CORRUPT, "Invalid region file.");
+
+    // Palette: file-local id -> IdRegistry id
+    RegionFile::Reader palette = RegionFile::get_section(data, sections, RegionFile::SECTION_PALETTE);
+    // Every entry takes at least its uint16 length, which bounds the count before allocating
+    const uint32_t palette_count = palette.read<uint32_t>();
+    ERR_FAIL_COND_V_MSG(!palette.is_valid() || palette_count > palette.get_remaining() / sizeof(uint16_t), ERR_FILE_CORRUPT, "Invalid region file palette.");
+    std::vector<uint16_t> id_map(palette_count);
+    for (uint16_t& id : id_map) {
+        const uint16_t length = palette.read<uint16_t>();
+        const uint8_t* name = palette.view(length);
+        if (!name) break;
+        id = id_reg->register_string(String::utf8(reinterpret_cast<const char*>(name), length));
+    }
+    ERR_FAIL_COND_V_MSG(!palette.is_valid(), ERR_FILE_CORRUPT, "Invalid region file palette.");
+    auto to_runtime = [&](uint16_t local) {
+        return (local < id_map.size()) ? id_map[local] : id_void;
+    };
+
+    const int count = REGION_SIZE * REGION_SIZE;
+    RegionFile::Reader chunks = RegionFile::get_section(data, sections, RegionFile::SECTION_CHUNKS);
+    const uint8_t* ids = chunks.view(count * sizeof(uint16_t));
+    const uint8_t* rots = chunks.view(count);
+    const uint8_t* biomes = chunks.view(count);
+    ERR_FAIL_COND_V_MSG(!chunks.is_valid(), ERR_FILE_CORRUPT, "Invalid region file chunks.");
+
+    std::unique_ptr<RegionData> region = std::make_unique<RegionData>();
+    region->coord = Vector2i(rx, ry);
+    region->chunk_ids.resize(count);
+    for (int i = 0; i < count; i++) {
+        uint16_t local;
+        std::memcpy(&local, ids + i * sizeof(uint16_t), sizeof(local));
+        region->chunk_ids[i] = to_runtime(local);
+    }
+    region->chunk_rots.assign(rots, rots + count);
+    region->biomes.assign(biomes, biomes + count);
+
+    RegionFile::Reader edits = RegionFile::get_section(data, sections, RegionFile::SECTION_EDITS);
+    if (edits.get_size() > 0) {
+        const uint32_t edited = edits.read<uint32_t>();
+        for (uint32_t i = 0; i < edited && edits.is_valid(); i++) {
+            const int32_t cx = edits.read<int32_t>();
+            const int32_t cy = edits.read<int32_t>();
+            const uint32_t offset = edits.read<uint32_t>();
+            if (!edits.is_valid()) break;
+            if (static_cast<size_t>(offset) + CHUNK_CELLS * sizeof(uint16_t) > edits.get_size()) {
+                ERR_FAIL_V_MSG(ERR_FILE_CORRUPT, "Invalid region file edit overlay.");
+            }
+            // Overlays may only touch chunks of the region being loaded
+            if (floor_div(cx, REGION_SIZE) != rx || floor_div(cy, REGION_SIZE) != ry) {
+                ERR_FAIL_V_MSG(ERR_FILE_CORRUPT, "Region file edit overlay lies outside its region.");
+            }
+            region->pending_edits[Occlusion::pack_coords(cx, cy)] = offset;
+        }
+        ERR_FAIL_COND_V_MSG(!edits.is_valid(), ERR_FILE_CORRUPT, "Invalid region file edits.");
+        if (!region->pending_edits.empty()) {
+            region->saved_edits.assign(edits.get_data(), edits.get_data() + edits.get_size());
+            region->saved_id_map = id_map;
+        }
+    }
+
+    // Validate the remaining sections before touching any live state
+    RegionFile::Reader seen = RegionFile::get_section(data, sections, RegionFile::SECTION_SEEN);
+    const uint32_t page_count = seen.get_size() > 0 ? seen.read<uint32_t>() : 0;
+    const uint8_t* pages = seen.view(static_cast<size_t>(page_count) * (2 * sizeof(int32_t) + sizeof(BitGrid::Page)));
+    RegionFile::Reader items = RegionFile::get_section(data, sections, RegionFile::SECTION_ITEMS);
+    const uint32_t stack_count = items.get_size() > 0 ? items.read<uint32_t>() : 0;
+    ERR_FAIL_COND_V_MSG(!seen.is_valid() || !items.is_valid(), ERR_FILE_CORRUPT, "Invalid region file.");
+
+    // The file restores the region rather than merging into it: drop the
+    // resident copy (its pending overlays belong to the state being replaced)
+    // and every edit, flag and seen bit inside the region's cells
+    const int span = REGION_SIZE * CHUNK_SIZE;
+    regions.erase(Occlusion::pack_coords(rx, ry));
+    tile_id_cache.erase_pages(rx * span, ry * span, (rx + 1) * span, (ry + 1) * span);
+    opaque_cells.erase_pages(rx * span, ry * span, (rx + 1) * span, (ry + 1) * span);
+    walkable_cells.erase_pages(rx * span, ry * span, (rx + 1) * span, (ry + 1) * span);
+    seen_cells.erase_pages(rx * span, ry * span, (rx + 1) * span, (ry + 1) * span);
+
+    RegionFile::Reader page_reader(pages, static_cast<size_t>(page_count) * (2 * sizeof(int32_t) + sizeof(BitGrid::Page)));
+    for (uint32_t i = 0; i < page_count; i++) {
+        const int32_t px = page_reader.read<int32_t>();
+        const int32_t py = page_reader.read<int32_t>();
+        uint64_t rows[BitGrid::PAGE_SIZE];
+        page_reader.read_bytes(rows, sizeof(rows));
+        seen_cells.set_page(px, py, rows);
+    }
+
+    // Saved stacks replace whatever is lying in the region now
+    for (auto it = dropped_items.begin(); it != dropped_items.end();) {
+        const Vector2i pos = unpack_coords(it->first);
+        const bool inside = pos.x >= rx * span && pos.x < (rx + 1) * span && pos.y >= ry * span && pos.y < (ry + 1) * span;
+        it = inside ? dropped_items.erase(it) : std::next(it);
+    }
+    for (uint32_t i = 0; i < stack_count && items.is_valid(); i++) {
+        const int32_t x = items.read<int32_t>();
+        const int32_t y = items.read<int32_t>();
+        const uint16_t id = items.read<uint16_t>();
+        const int32_t amount = items.read<int32_t>();
+        if (items.is_valid()) {
+            dropped_items[Occlusion::pack_coords(x, y)].push_back({ to_runtime(id), amount });
+        }
+    }
+
+    // Chunks generated from a previous copy of the region are stale
+    generated_tiles.clear();
+    publish_region(std::move(region));
+    return OK;
+}
+
 void WorldGeneration::drop_item(const Vector2i& pos, const String& item_id, int amount) {
     IdRegistry* id_reg = IdRegistry::get_singleton();
     if (!id_reg) return;
@@ -329,6 +1135,7 @@ void WorldGeneration::drop_item(const Vector2i& pos, const String& item_id, int
     uint64_t key = Occlusion::pack_coords(pos.x, pos.y);
     
     dropped_items[key].push_back({id, amount});
+    invalidate_cell(pos.x, pos.y);
 }
 
 bool WorldGeneration::pickup_item(const Vector2i& pos, Inventory* p_inventory) {
@@ -345,6 +1152,7 @@ bool WorldGeneration::pickup_item(const Vector2i& pos, Inventory* p_inventory) {
             if (it->second.empty()) {
                 dropped_items.erase(it);
             }
+            invalidate_cell(pos.x, pos.y);
             return true;
         }
     }
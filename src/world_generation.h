@@ -4,6 +4,7 @@
 #include <godot_cpp/classes/node2d.hpp>
 #include <godot_cpp/classes/fast_noise_lite.hpp>
 #include <godot_cpp/classes/texture2d.hpp>
+#include <godot_cpp/classes/image.hpp>
 #include <godot_cpp/classes/rendering_server.hpp>
 #include <godot_cpp/variant/array.hpp>
 #include <godot_cpp/variant/vector2i.hpp>
@@ -11,9 +12,13 @@
 #include <godot_cpp/variant/rid.hpp>
 #include <godot_cpp/variant/color.hpp>
 #include <godot_cpp/variant/rect2i.hpp>
+#include <godot_cpp/variant/packed_int32_array.hpp>
+#include <godot_cpp/variant/packed_string_array.hpp>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
+#include <mutex>
+#include <memory>
 #include <cmath>
 #include <godot_cpp/variant/utility_functions.hpp>
 #include "occlusion.h"
@@ -24,6 +29,8 @@
 #include "data/inventory.h"
 
 #include "fast_tilemap.h"
+#include "chunk_tile_cache.h"
+#include "coord_hash.h"
 
 namespace godot {
 
@@ -37,10 +44,47 @@ struct DroppedItem {
     int amount;
 };
 
+// A resident region of REGION_SIZE x REGION_SIZE chunks, stored row-major
+// and indexed directly by region-local chunk coords
+struct RegionData {
+    Vector2i coord;
+    std::vector<uint16_t> chunk_ids;
+    std::vector<uint8_t> chunk_rots;
+    std::vector<uint8_t> biomes; // Underlying biome per chunk (WorldGeneration::BIOME_*)
+    uint64_t last_used = 0;
+
+    // Edit overlays loaded from a region file, decoded per chunk on first use
+    std::vector<uint8_t> saved_edits;
+    std::vector<uint16_t> saved_id_map; // File-local id -> IdRegistry id
+    std::unordered_map<uint64_t, uint32_t> pending_edits; // Chunk key -> offset in saved_edits
+
+    size_t get_memory_usage() const {
+        return sizeof(RegionData) + chunk_ids.capacity() * sizeof(uint16_t) + chunk_rots.capacity() * sizeof(uint8_t) + biomes.capacity() +
+               saved_edits.capacity() + saved_id_map.capacity() * sizeof(uint16_t);
+    }
+};
+
 struct BiomeInfo {
+    static constexpr int ROLL_RANGE = 100;
+
     std::vector<BiomeTile> ground_tiles;
     // Map for specific overrides (e.g. chunk_id -> fixed_tile_id)
     std::unordered_map<uint16_t, uint16_t> fixed_overrides;
+    // Tile for every roll in [0, ROLL_RANGE), compiled from ground_tiles
+    uint16_t roll_table[ROLL_RANGE] = {};
+
+    // Rolls past the total weight fall back to the first tile
+    void compile_roll_table(uint16_t fallback_id) {
+        const uint16_t first = ground_tiles.empty() ? fallback_id : ground_tiles[0].id;
+        size_t tile = 0;
+        int cumulative = ground_tiles.empty() ? 0 : ground_tiles[0].weight;
+        for (int roll = 0; roll < ROLL_RANGE; roll++) {
+            while (tile < ground_tiles.size() && roll >= cumulative) {
+                if (++tile < ground_tiles.size()) cumulative += ground_tiles[tile].weight;
+            }
+            roll_table[roll] = (tile < ground_tiles.size()) ? ground_tiles[tile].id : first;
+        }
+    }
 };
 
 class WorldGeneration : public FastTileMap {
@@ -51,6 +95,11 @@ public:
     static constexpr uint32_t ORIENTATION_SHIFT = 16;
     static constexpr uint32_t ID_MASK = 0xFFFF;
 
+    enum {
+        BIOME_PLAINS = 0,
+        BIOME_FOREST = 1
+    };
+
     enum {
         ROT_SOUTH = 0,
         ROT_WEST = 1,
@@ -62,16 +111,26 @@ private:
     // Constants
     static const int REGION_SIZE = 256;
     static const int CHUNK_SIZE = 24;
+    static const int CHUNK_CELLS = CHUNK_SIZE * CHUNK_SIZE;
+
+    // Streaming: resident regions keyed by region coords, evicted least recently used
+    std::unordered_map<uint64_t, std::unique_ptr<RegionData>> regions;
+    uint64_t region_use_tick = 0;
+    int max_resident_regions = 9;
+    int prefetch_margin = 32; // Chunks from a region border at which the neighbour is prefetched
+
+    // Async region generation
+    std::mutex region_mutex;
+    std::unordered_map<uint64_t, std::unique_ptr<RegionData>> finished_regions;
+    std::unordered_map<uint64_t, int64_t> region_tasks;
 
-    std::unordered_map<uint64_t, uint32_t> region_chunks; // Packed: [Rot][ID]
     std::unordered_map<uint64_t, std::vector<DroppedItem>> dropped_items;
     
-    // Performance Cache: Last Chunk
-    uint64_t last_chunk_key = 0;
-    uint16_t last_chunk_id = 0;
-    uint8_t last_chunk_rotation = 0;
-    const BiomeInfo* last_biome_ptr = nullptr;
-    bool last_chunk_valid = false;
+    // Generated tiles, per chunk under a memory budget; player edits live in tile_id_cache
+    ChunkTileCache generated_tiles{CHUNK_CELLS};
+    
+    // Visibility of the current bubble, recomputed every update
+    FieldOfView fov;
     
     // Pre-fetched singletons
     class StructureDb* s_db = nullptr;
@@ -87,20 +146,39 @@ private:
     uint16_t id_forest = 0;
     uint16_t id_plains = 0;
     std::unordered_map<uint16_t, BiomeInfo> biome_rules;
+    // Chunk id -> structure handle placed on it; chunks named after a structure place it directly
+    std::unordered_map<uint16_t, uint16_t> chunk_structures;
     
     // Helpers
-    uint32_t get_hash(int x, int y, uint32_t seed) const {
-        return (static_cast<uint32_t>(x) * 1597334677U) ^ 
-               (static_cast<uint32_t>(y) * 3812015801U) ^ 
-               (seed);
-    }
+    uint32_t get_hash(int x, int y, uint32_t seed) const { return CoordHash::hash(x, y, seed); }
     uint16_t get_tile(int x, int y);
-    uint16_t pick_weighted_tile(const BiomeInfo& info, uint32_t roll);
+    bool generate_chunk_tiles(const Vector2i& chunkPos, uint16_t* out);
+    const uint16_t* get_structure_tiles(uint16_t chunk_id, uint8_t rotation) const;
     void setup_biome_rules();
+    static int floor_div(int a, int b) { return (a >= 0) ? (a / b) : ((a - (b - 1)) / b); }
+
+    Ref<FastNoiseLite> snapshot_biome_noise() const;
+    void generate_biome_map(const Vector2i& regionPos, uint32_t seed, const Ref<FastNoiseLite>& noise, RegionData& r_region) const;
+    void generate_region(const Vector2i& regionPos, uint32_t seed, const Ref<FastNoiseLite>& noise, RegionData& r_region) const;
+    Dictionary build_region_dictionary(const RegionData& p_region) const;
+    Dictionary build_region_packed(const RegionData& p_region) const;
+    void _region_task(const Vector2i& regionPos, int seed, const Ref<FastNoiseLite>& noise);
+
+    RegionData* find_region(int rx, int ry) const;
+    RegionData* ensure_region(const Vector2i& regionPos);
+    void request_region(const Vector2i& regionPos);
+    void publish_region(std::unique_ptr<RegionData> p_region);
+    void evict_regions(const Vector2i& keep);
+    void apply_saved_edits(RegionData& r_region, uint64_t chunk_key);
+    void flush_saved_edits(RegionData& r_region);
+    void update_streaming(const Vector2i& playerPos, const Vector2i& heading);
 
 protected:
     static void _bind_methods();
 
+    void render_cell(TileSlot& slot, int cx, int cy, RenderingServer* rs, RID texture_rid, TileDb* tile_db) override;
+    uint16_t get_cell_id(int x, int y) override;
+
 public:
     WorldGeneration();
     ~WorldGeneration();
@@ -120,9 +198,37 @@ public:
     Ref<FastNoiseLite> get_biome_noise() const;
     void set_world_seed(int seed);
     int get_world_seed() const;
+    void set_max_resident_regions(int p_count) { max_resident_regions = p_count > 1 ? p_count : 1; }
+    int get_max_resident_regions() const { return max_resident_regions; }
+    void set_prefetch_margin(int p_chunks) { prefetch_margin = p_chunks; }
+    int get_prefetch_margin() const { return prefetch_margin; }
+    void set_tile_cache_budget(int64_t p_bytes) { generated_tiles.set_budget(p_bytes > 0 ? static_cast<size_t>(p_bytes) : 0); }
+    int64_t get_tile_cache_budget() const { return static_cast<int64_t>(generated_tiles.get_budget()); }
+    int64_t get_tile_cache_memory_usage() const { return static_cast<int64_t>(generated_tiles.get_memory_usage()); }
+
+    static Vector2i get_region_at(const Vector2i& cellPos) {
+        return Vector2i(
+            floor_div(floor_div(cellPos.x, CHUNK_SIZE), REGION_SIZE),
+            floor_div(floor_div(cellPos.y, CHUNK_SIZE), REGION_SIZE)
+        );
+    }
+    String get_biome_at(const Vector2i& cellPos) const;
+    bool is_region_resident(const Vector2i& regionPos) const { return find_region(regionPos.x, regionPos.y) != nullptr; }
+    int get_resident_region_count() const { return static_cast<int>(regions.size()); }
+    int64_t get_region_memory_usage() const;
+    Dictionary benchmark_chunk_lookup(int p_iterations);
+    Dictionary benchmark_hash_kernel(int p_rows);
     
+    void set_chunk_structure(const String& chunk_id, const String& structure_id);
+    PackedInt32Array get_tiles_rect(const Rect2i& rect);
     void update_world_bubble(const Vector2i& playerPos);
     Dictionary init_region(const Vector2i& regionPos);
+    void init_region_async(const Vector2i& regionPos);
+    Dictionary init_region_packed(const Vector2i& regionPos);
+    Ref<Image> build_region_map_image(const Vector2i& regionPos, bool p_sprites = true, bool p_mipmaps = false);
+    void _finish_region_task(const Vector2i& regionPos, const Dictionary& regionData);
+    Error save_region(const Vector2i& regionPos, const String& path);
+    Error load_region(const String& path);
     void drop_item(const Vector2i& pos, const String& item_id, int amount);
     bool pickup_item(const Vector2i& pos, Inventory* p_inventory);
     bool has_item(const Vector2i& pos) const;